@@ -1,56 +1,113 @@
 #ifndef RB_TREE_HPP
 # define RB_TREE_HPP
 
+#include <new>
 #include <stdexcept>
 #include "RB_Tree_iterator.hpp"
+#include "RB_Tree_augment.hpp"
 #include "printMap.hpp"
 
 namespace ft {
-	template < typename T, typename Compare = ft::less<T>, typename Alloc = std::allocator<T> >
-	class RBTree {
+	// Key	- 비교에 사용하는 key 타입
+	// T	- 노드에 저장되는 값 타입
+	// KeyOfValue	- T에서 key를 꺼내는 함수 객체 (map은 select1st)
+	// Compare	- key 끼리 비교하는 함수 객체
+	// Augment	- 노드마다 서브트리의 값을 모아 저장하는 정책 (RB_Tree_augment.hpp, 기본값은 저장하지 않음)
+	// 비교 객체와 노드 allocator는 대부분 비어있으므로 ebo_storage를 상속해 저장한다.
+	template < typename Key, typename T, typename KeyOfValue, typename Compare = ft::less<Key>, typename Alloc = std::allocator<T>, typename Augment = ft::rb_no_augment >
+	class RBTree : private ft::ebo_storage< Compare, 0 >,
+		private ft::ebo_storage< typename Alloc::template rebind< typename ft::rb_augment_node<T, Augment>::type >::other, 1 > {
 		public :
+			typedef Key	key_type;
 			typedef T	value_type;
 			typedef T*	pointer;
 			typedef const T*	const_pointer;
 			typedef T&	reference;
 			typedef const T&	const_reference;
-			typedef Compare	value_comp;
+			typedef Compare	key_compare;
 			typedef Alloc	allocator_type;
 			typedef size_t	size_type;
-			typedef ft::RBTreeNode<T>	node_type;
+			typedef typename ft::rb_augment_node<T, Augment>::type	node_type;
+			typedef ft::RBTreeNodeBase::base_ptr	base_ptr;
 			typedef typename ft::RBTreeIterator<T, T*, T&>	iterator;
 			typedef typename ft::RBTreeIterator<T, const T*, const T&>	const_iterator;
 			typedef typename Alloc::template rebind<node_type>::other	node_allocator_type;
 			// rebind - T타입이 아닌 다른 타입에 대한 allocate가 필요
+			typedef typename Augment::result_type	result_type;
 
 		private:
-			node_type*	_root;
-			node_type*	_nil;
+			typedef ft::ebo_storage<key_compare, 0>	comp_base;
+			typedef ft::ebo_storage<node_allocator_type, 1>	alloc_base;
+			// key_compare가 한 번에 <0, 0, >0을 알려줄 수 있으면 true_type, 아니면 false_type을 상속한다.
+			typedef ft::three_way_compare<key_compare, key_type>	three_way;
+			// 노드에 data를 저장하면 true_type, 아니면 false_type -> 갱신 함수를 고른다.
+			typedef typename Augment::enabled	augmented;
+			typedef typename Augment::data_type	augment_data;
+
+			// end 노드 (leftChild - root, parent - 가장 오른쪽 노드, rightChild - 자기 자신)
+			// tree 안에 들어있으므로 빈 tree를 만들 때 할당하지 않는다.
+			RBTreeNodeBase	_header;
+			base_ptr	_leftmost;	// 가장 작은 값을 가진 노드 (begin)
 			size_type	_size;
-			value_comp	_comp;
-			node_allocator_type	_node_alloc;
+
+			// 지워진 노드를 재사용하기 위한 free-list와 reserve로 받은 slab 목록
+			// 노드를 처음 free-list에 넣거나 reserve할 때 할당한다. -> 지우지 않는 tree는 포인터 하나만 차지한다.
+			// free-list의 노드는 value가 소멸된 상태이고 leftChild로 연결한다.
+			struct node_pool {
+				base_ptr	free_nodes;	// 하나씩 할당한 노드, 사용 중인 노드 수(_size)보다 많이 두지 않는다.
+				size_type	free_count;
+				base_ptr	slab_nodes;	// slab에 속한 노드, slab과 같이 해제되므로 개수를 제한하지 않는다.
+				size_type	slab_count;
+				base_ptr	slabs;	// 첫 노드가 header, leftChild로 다음 slab을, rightChild로 slab의 끝을 가리킨다.
+			};
+			typedef typename Alloc::template rebind<node_pool>::other	pool_allocator_type;
+
+			node_pool*	_pool;
 
 
 		public:
 			//Member functions
 			//Default constructor
-			RBTree() : _root(NULL), _nil(NULL), _size(0), _comp(value_comp()), _node_alloc(node_allocator_type()) {
-				this->_nil = make_nil();
-				this->_root = this->_nil;
+			explicit RBTree(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : comp_base(comp), alloc_base(node_allocator_type(alloc)), _header(), _leftmost(NULL), _size(0), _pool(NULL) {
+				set_header(nil(), NULL, NULL);
 			}
 
 			//Copy constructor
-			RBTree(const RBTree& x) : _root(NULL), _nil(NULL), _size(0), _comp(value_comp()), _node_alloc(node_allocator_type()) {
-				this->_nil = make_nil();
-				copy(x);
-				this->_nil->parent = get_max_value_node();
+			RBTree(const RBTree& x) : comp_base(x.get_comp()), alloc_base(x.get_node_alloc()), _header(), _leftmost(NULL), _size(0), _pool(NULL) {
+				set_header(nil(), NULL, NULL);
+				//생성자에서 던지면 소멸자가 불리지 않으므로 free-list로 돌아간 노드를 여기서 해제한다.
+				try {
+					copy(x);
+				}
+				catch (...) {
+					release_pool();
+					throw;
+				}
+			}
+
+#if __cplusplus >= 201103L
+			//Move constructor (c++11)
+			//빈 tree를 만든 뒤 x와 바꾼다. -> 노드를 복사하지 않는다.
+			RBTree(RBTree&& x) : comp_base(x.get_comp()), alloc_base(x.get_node_alloc()), _header(), _leftmost(NULL), _size(0), _pool(NULL) {
+				set_header(nil(), NULL, NULL);
+				swap(x);
+			}
+
+			//Move assignment (c++11)
+			RBTree& operator=(RBTree&& x) {
+				if (this != &x) {
+					clear();
+					swap(x);
+				}
+				return (*this);
 			}
+#endif
 
 			//Destructor
 			~RBTree() {
-				clear();
-				_node_alloc.destroy(this->_nil);
-				_node_alloc.deallocate(this->_nil, 1);
+				//slab이 없으면 노드를 free-list에 넣지 않고 바로 해제한다. -> 노드마다 한 번만 읽는다.
+				destroy_subtree(root(), !has_slabs());
+				release_pool();
 			}
 
 			//Assignment operator
@@ -60,33 +117,26 @@ namespace ft {
 				return (*this);
 			}
 
+			//x와 같은 모양, 같은 색의 tree를 그대로 복제한다.
+			//비교나 회전 없이 노드마다 한 번씩만 복사하므로 O(n)
 			void copy(const RBTree& x) {
 				clear();
-				copy(x._root);
-			}
-
-			void copy(node_type* node) {
-				if (node->value == NULL)
+				get_comp() = x.get_comp();
+				if (x.root() == nil())
 					return ;
-				insert(*node->value);
-				if (node->leftChild->value != NULL)
-					copy(node->leftChild);
-				if (node->rightChild->value != NULL)
-					copy(node->rightChild);
+				base_ptr new_root = clone_node(x.root(), header());
+				set_header(new_root, get_min_node(new_root), get_max_node(new_root));
 			}
 
 			//Iterators
-			//가장 작은 값을 찾는다.
-			node_type* get_begin() const {
-				node_type* tmp = this->_root;
-				while (tmp->leftChild->value != NULL)
-					tmp = tmp->leftChild;
-				return (tmp);
+			//가장 작은 값을 가진 노드는 삽입/삭제 때 갱신해두므로 O(1)
+			base_ptr get_begin() const {
+				return (this->_leftmost);
 			}
 
-			//nil노드를 가리키게 한다.
-			node_type* get_end() const {
-				return (this->_nil);
+			//header노드를 가리키게 한다.
+			base_ptr get_end() const {
+				return (header());
 			}
 
 			//Capacity
@@ -99,257 +149,1181 @@ namespace ft {
 			}
 
 			size_type max_size() const {
-				return (_node_alloc.max_size());
+				return (get_node_alloc().max_size());
 			}
 
-			ft::pair<node_type*, bool> insert(const value_type& val, node_type* hint = NULL) {
-				//val 값을 인자로 입력하여 노드를 생성한다.
-				node_type* new_node = make_node(val);
-				//노드가 삽일될 위치를 탐색한다. tree가 비어있을 경우를 대비해 초기 위치를 root로 설정한다.
-				node_type* position = this->_root;
-				//tree가 비어있을 경우, 생성한 노드(new_node)를 root로 지정한다.
-				if (this->_size == 0) {
-					this->_root = new_node;
-					this->_root->leftChild = this->_nil;
-					this->_root->rightChild = this->_nil;
-					this->_root->parent = this->_nil; //여기서 중요한 점이 root의 부모도 nil노드를 가리키게 설정
-					this->_root->color = BLACK;
-					this->_nil->parent = this->_root; //다시 nil의 부모를 root로 설정
-					this->_size++;
-					return (ft::make_pair(this->_root, true)); //새로 만든
-				}
-				//hint의 위치가 유효한지 확인한다.
+			//Observers
+			key_compare key_comp() const {
+				return (get_comp());
+			}
+
+			allocator_type get_allocator() const {
+				return (allocator_type(get_node_alloc()));
+			}
+
+			ft::pair<base_ptr, bool> insert(const value_type& val, base_ptr hint = NULL) {
+				//노드를 만들기 전에 삽입될 위치부터 찾는다.
+				//같은 key가 이미 있으면 노드를 할당하지 않고 그 노드를 반환한다.
+				bool is_left;
+				ft::pair<base_ptr, bool> position = get_insert_position(KeyOfValue()(val), hint, is_left);
+				if (position.second == false)
+					return (position);
+				return (ft::make_pair(insert_at(position.first, is_left, val), true));
+			}
+
+#if __cplusplus >= 201103L
+			ft::pair<base_ptr, bool> insert(value_type&& val, base_ptr hint = NULL) {
+				bool is_left;
+				ft::pair<base_ptr, bool> position = get_insert_position(KeyOfValue()(val), hint, is_left);
+				if (position.second == false)
+					return (position);
+				return (ft::make_pair(insert_at(position.first, is_left, std::move(val)), true));
+			}
+
+			//인자로 노드를 먼저 만든 뒤 그 key로 위치를 찾는다. (c++11)
+			//같은 key가 이미 있으면 만든 노드를 다시 해제한다.
+			template <typename... Args>
+			ft::pair<base_ptr, bool> emplace(base_ptr hint, Args&&... args) {
+				base_ptr new_node = make_node(std::forward<Args>(args)...);
+				bool is_left;
+				ft::pair<base_ptr, bool> position = get_insert_position(get_key(new_node), hint, is_left);
+				if (position.second == false) {
+					destroy_node(new_node);
+					return (position);
+				}
+				return (ft::make_pair(link_node(position.first, is_left, new_node), true));
+			}
+#endif
+
+			//같은 key를 허용하는 삽입 (multiset / multimap)
+			//같은 key가 이미 있으면 그 key들의 가장 뒤에 넣는다. -> 같은 key끼리는 넣은 순서가 유지된다.
+			//hint가 맞으면 hint 바로 앞에 넣는다.
+			base_ptr insert_equal(const value_type& val, base_ptr hint = NULL) {
+				bool is_left;
+				base_ptr parent = get_equal_position(KeyOfValue()(val), hint, is_left);
+				return (insert_at(parent, is_left, val));
+			}
+
+#if __cplusplus >= 201103L
+			base_ptr insert_equal(value_type&& val, base_ptr hint = NULL) {
+				bool is_left;
+				base_ptr parent = get_equal_position(KeyOfValue()(val), hint, is_left);
+				return (insert_at(parent, is_left, std::move(val)));
+			}
+
+			template <typename... Args>
+			base_ptr emplace_equal(base_ptr hint, Args&&... args) {
+				base_ptr new_node = make_node(std::forward<Args>(args)...);
+				bool is_left;
+				base_ptr parent = get_equal_position(get_key(new_node), hint, is_left);
+				return (link_node(parent, is_left, new_node));
+			}
+#endif
+
+			//k가 들어갈 부모 노드를 찾는다. 노드는 만들지 않는다.
+			//삽입 가능 - (부모 노드, true), is_left에 부모의 어느 쪽 자식이 될지 기록한다.
+			//삽입 불가 - (같은 key를 가진 노드, false)
+			//tree가 비어있으면 부모는 header이다.
+			ft::pair<base_ptr, bool> get_insert_position(const key_type& k, base_ptr hint, bool& is_left) {
+				//노드가 삽일될 위치를 탐색한다. 초기 위치는 root로 설정한다.
+				base_ptr position = root();
+				is_left = true;
+				if (position == nil())
+					return (ft::make_pair(header(), true));
+				//hint가 있으면 hint 주변에 바로 붙일 수 있는지 먼저 확인한다.
 				//single element의 경우 hint는 null
-				if (hint != NULL && hint->value != NULL)
-					position = check_hint(val, hint);
-				//노드를 삽입할 위치를 탐색한다.
-				//leftchild와 rightchild에 삽입을 실패하면 false를 반환
-				ft::pair<node_type*, bool> is_valid = get_position(position, new_node);
-				if (is_valid.second == false) {
-					_node_alloc.destroy(new_node);
-					_node_alloc.deallocate(new_node, 1);
-					return (is_valid);
+				if (hint != NULL) {
+					ft::pair<base_ptr, bool> res = check_hint(k, hint, is_left);
+					if (res.first != NULL)
+						return (res);
+				}
+				return (get_position(position, k, is_left));
+			}
+
+			//get_insert_position으로 찾은 위치에 val을 가진 노드를 만들어 연결한다.
+			base_ptr insert_at(base_ptr parent, bool is_left, const value_type& val) {
+				return (link_node(parent, is_left, make_node(val)));
+			}
+
+#if __cplusplus >= 201103L
+			base_ptr insert_at(base_ptr parent, bool is_left, value_type&& val) {
+				return (link_node(parent, is_left, make_node(std::move(val))));
+			}
+#endif
+
+			//이미 만들어진 new_node를 parent의 자식으로 연결하고 균형을 맞춘다.
+			base_ptr link_node(base_ptr parent, bool is_left, base_ptr new_node) {
+				new_node->set_parent(parent);
+				//tree가 비어있을 경우, 생성한 노드(new_node)를 root로 지정한다.
+				//root의 부모는 header노드를 가리킨다.
+				if (parent == header())
+					set_header(new_node, new_node, new_node);
+				//가장 왼쪽/오른쪽 노드의 자식으로 들어간 경우에만 갱신한다.
+				//회전은 중위 순회 순서를 바꾸지 않으므로 여기서 한 번만 확인하면 된다.
+				else if (is_left) {
+					parent->leftChild = new_node;
+					if (parent == this->_leftmost)
+						this->_leftmost = new_node;
+				}
+				else {
+					parent->rightChild = new_node;
+					if (parent == rightmost())
+						header()->set_parent(new_node);
 				}
+				//회전은 두 노드의 data만 다시 계산하므로 회전 전에 root까지의 data를 먼저 맞춘다.
+				update_node(new_node);
+				update_path(parent, 1);
 				//new_node 삽입 후 rbtree의 규칙(속성)에 따라 균형을 잡아야한다.
 				//이는 insert_case에 따라 rotate를 통해 진행한다.
 				insert_case1(new_node);
 				this->_size++;
-				this->_nil->parent = get_max_value_node();
-				return (ft::make_pair(new_node, true));
+				return (new_node);
 			}
 
-			size_type erase(node_type* node) {
-				//삭제할 노드가 nil 노드인 경우 0을 반환 -> map에서 삭제가 실패한 경우 0을 반환
-				if (node->value == NULL)
+			//정렬된 구간 [first, last)로 빈 tree를 O(n)에 만든다.
+			//unique - true이면 key가 겹치지 않아야 한다. (map / set) false이면 같은 key가 이어져도 된다. (multiset / multimap)
+			//한 번 훑으며 개수와 정렬 여부를 확인하고, 조건을 만족하지 않으면 아무것도 하지 않고 false를 반환한다.
+			//두 번 읽어야 하므로 forward iterator 이상에서만 동작한다.
+			template <typename ForwardIterator>
+			bool build_sorted(ForwardIterator first, ForwardIterator last, bool unique, ft::forward_iterator_tag) {
+				if (this->_size != 0 || first == last)
+					return (false);
+				size_type n = 1;
+				ForwardIterator prev = first;
+				for (ForwardIterator it = ++ForwardIterator(first); it != last; ++it, ++prev, ++n) {
+					if (unique ? !get_comp()(KeyOfValue()(*prev), KeyOfValue()(*it))
+						: get_comp()(KeyOfValue()(*it), KeyOfValue()(*prev)))
+						return (false);
+				}
+				//가운데 값을 root로 잡으면 nil까지의 깊이는 floor(log2(n+1)) 또는 그보다 1 크다.
+				//더 깊은 쪽(마지막 층)의 노드만 RED로 칠하면 모든 경로의 black 수가 같아진다.
+				size_type red_depth = 0;
+				while ((static_cast<size_type>(2) << red_depth) <= n + 1)
+					red_depth++;
+				base_ptr new_root = build_node(first, n, 0, red_depth);
+				set_header(new_root, get_min_node(new_root), get_max_node(new_root));
+				return (true);
+			}
+
+			//input iterator는 한 번만 읽을 수 있으므로 확인할 수 없다.
+			template <typename InputIterator>
+			bool build_sorted(InputIterator, InputIterator, bool, ft::input_iterator_tag) {
+				return (false);
+			}
+
+			size_type erase(base_ptr node) {
+				//삭제할 노드가 end(header) 노드인 경우 0을 반환 -> map에서 삭제가 실패한 경우 0을 반환
+				if (node == header())
 					return (0);
+				destroy_node(unlink_node(node));
+				return (1);
+			}
+
+			//node를 tree에서 떼어내고 균형을 맞춘 뒤 반환한다. value는 그대로 두므로 다른 곳에 다시 연결할 수 있다.
+			//떼어낸 노드의 링크와 색은 의미가 없다.
+			base_ptr unlink_node(base_ptr node) {
+				//지울 노드가 가장 왼쪽/오른쪽 노드라면 바로 옆 노드로 미리 갱신한다.
+				//replace_erase_node는 값이 아닌 노드 자체의 위치를 바꾸므로 다른 노드의 포인터는 유효하다.
+				if (node == this->_leftmost)
+					this->_leftmost = get_next_node(node);
+				if (node == rightmost())
+					header()->set_parent(get_prev_node(node));
 				//node의 왼쪽 서브트리에서 최댓값 / 오른쪽 서브트리에서 최솟값을 찾은 후 위치를 변경한다.
 				//기존 target위치에는 대체할 node가 들어가있다.
 				//target 노드 자체를 삭제해야 한다.
 				//node와 target의 값을 바꾸고 target을 리턴받음.
 				//위치변경 후 target은 child에 non-nil 노드가 최대 1개이다.
 				//child는 target노드의 non-nil child가 우선이다.
-				node_type* target = replace_erase_node(node);
-				node_type* child;
-				if (target->rightChild->value == NULL)
+				base_ptr target = replace_erase_node(node);
+				base_ptr child;
+				if (target->rightChild == nil())
 					child = target->leftChild;
 				else
 					child = target->rightChild;
+				//child가 nil이면 parent를 기록할 수 없으므로 target의 부모를 따로 넘긴다. (nil에는 쓰지 않는다)
+				base_ptr parent = target->get_parent();
 				//1) target이 RED인 경우, 무조건 그 자식 노드들이 nil일 때만 발생한다(BLACK). target을 nil로 바꾸면 해결
 				replace_node(target, child);
-				if (target->color == BLACK) {
+				//target이 빠진 자리부터 root까지의 data를 회전 전에 다시 맞춘다. (node 자리로 옮겨진 노드도 이 경로 위에 있다)
+				update_path(parent, -1);
+				if (target->get_color() == BLACK) {
 					//2) target이 BLACK이고 child가 RED인 경우,
 					//target과 child의 색을 바꾸고 child의 색을 BLACK으로 바꾼다.
-					if (child->color == RED)
-						child->color = BLACK;
+					if (child->get_color() == RED)
+						child->set_color(BLACK);
 					else
-						delete_case1(child);
+						delete_case1(child, parent);
 					//3) target과 child가 모두 BLACK인 경우, child는 무조건 nil이었을 것이다.
 					//두 개의 nil노드를 가지고 있는 검은 노드를 지우는 상황에서만 발생
 					//사실상 target노드의 두 자식은 모두 nil이다. -> child노드도 nil
-					//replace_node에서 child(nil)->parent를 상황에 맞게 설정
 				}
 				this->_size--;
-				if (target->parent->value == NULL)
-					this->_root = this->_nil;
-				delete target;
-				this->_nil->parent = get_max_value_node();
-				return (1);
+				return (target);
+			}
+
+			//[first, last) 구간의 노드를 지우고 지운 개수를 반환한다.
+			//erase는 노드의 위치만 바꾸므로 다음 노드를 미리 구해두면 그대로 쓸 수 있다.
+			//tree 전체를 지우는 경우는 clear로 한 번에 지운다.
+			size_type erase(base_ptr first, base_ptr last) {
+				if (first == this->_leftmost && last == header()) {
+					size_type n = this->_size;
+					clear();
+					return (n);
+				}
+				size_type n = 0;
+				while (first != last) {
+					base_ptr next = get_next_node(first);
+					n += erase(first);
+					first = next;
+				}
+				return (n);
 			}
 
 			void swap(RBTree& x) {
-				swap(_root, x._root);
-				swap(_nil, x._nil);
-				swap(_comp, x._comp);
-				swap(_node_alloc, x._node_alloc);
+				//header는 각 tree 안에 있으므로 바꿀 수 없다. -> 노드들을 상대 header에 다시 연결한다.
+				base_ptr this_root = root(), this_leftmost = this->_leftmost, this_rightmost = rightmost();
+				set_header(x.root(), x._leftmost, x.rightmost());
+				x.set_header(this_root, this_leftmost, this_rightmost);
+				swap(get_comp(), x.get_comp());
+				swap(get_node_alloc(), x.get_node_alloc());
 				swap(_size, x._size);
+				swap(_pool, x._pool);
 			}
 
-			void clear(node_type* node = NULL) {
-				if (node == NULL)
-					node = this->_root;
-				if (node->leftChild->value != NULL) {
-					clear(node->leftChild);
-					node->leftChild = this->_nil;
+			/**
+			 * split
+			 * key가 k 이상인 노드를 right로 옮기고 k보다 작은 노드만 남긴다. right에 있던 노드는 먼저 지운다.
+			 * root부터 k의 자리까지 내려가며 경로 밖의 서브트리를 그대로 떼어 두고,
+			 * 올라오면서 경로 위의 노드를 pivot으로 삼아 join_tree로 양쪽에 다시 붙인다.
+			 * join_tree의 비용은 두 서브트리의 black height 차이이고 그 합이 root의 black height를 넘지 않으므로 자르는 데는 O(log n)
+			 * 노드를 새로 할당하지 않고 옮긴다.
+			 * 개수는 서브트리 크기가 있으면 O(1), 없으면 양쪽을 번갈아 세어 작은 쪽의 개수만큼 든다.
+			 * -> 전체 비용은 augment가 있으면 O(log n), 없으면 O(log n + min(|left|, |right|))
+			 * right가 노드를 가져올 수 없으면 (can_adopt) 옮길 구간을 복사해 만든다. -> O(n)
+			 */
+			void split(const key_type& k, RBTree& right) {
+				if (this == &right)
+					return ;
+				right.clear();
+				right.get_comp() = get_comp();
+				if (empty())
+					return ;
+				if (!right.can_adopt(*this)) {
+					base_ptr first = lower_bound(k);
+					right.build_sorted(const_iterator(first), const_iterator(header()), false, ft::forward_iterator_tag());
+					erase(first, header());
+					return ;
+				}
+				size_type total = this->_size;
+				base_ptr left_root, right_root;
+				size_type left_height, right_height;
+				split_node(root(), get_black_height(root()), k, left_root, left_height, right_root, right_height);
+				reset_root(left_root);
+				right.reset_root(right_root);
+				this->_size = count_split(right, total, augmented());
+				right._size = total - this->_size;
+			}
+
+			/**
+			 * join
+			 * other의 노드를 모두 옮겨온다. other는 비게 된다.
+			 * other의 key가 모두 이 tree의 key보다 크거나 (또는 모두 작으면)
+			 * 한쪽 끝 노드 하나를 떼어 pivot으로 삼고 black height가 같은 자리에 붙인다. -> O(log n), 노드를 할당하지 않는다.
+			 * unique - true이면 (map / set) 양쪽에 같은 key가 있으면 안 된다. false이면 (multi) 경계의 key가 같아도 된다.
+			 * key 범위가 겹치거나 노드를 가져올 수 없으면 (can_adopt) 하나씩 넣는다. -> O(|other| log n)
+			 * 이때 unique이면 이미 있는 key는 other에 남는다.
+			 */
+			void join(RBTree& other, bool unique) {
+				if (this == &other || other.empty())
+					return ;
+				if (!can_adopt(other)) {
+					join_by_copy(other, unique);
+					return ;
+				}
+				if (empty()) {
+					reset_root(other.root());
+					this->_size = other._size;
 				}
-				if (node->rightChild->value != NULL) {
-					clear(node->rightChild);
-					node->rightChild = this->_nil;
+				else if (is_before(rightmost(), other._leftmost, unique)) {
+					size_type total = this->_size + other._size;
+					base_ptr pivot = unlink_node(rightmost());
+					size_type height;
+					reset_root(join_tree(root(), get_black_height(root()), pivot, other.root(), get_black_height(other.root()), height));
+					this->_size = total;
 				}
-				// delete
-				if (node->value != NULL) {
-					if (node == this->_root)
-						this->_root = this->_nil;
-					_node_alloc.destroy(node);
-					_node_alloc.deallocate(node, 1);
-					this->_size--;
+				else if (is_before(other.rightmost(), this->_leftmost, unique)) {
+					size_type total = this->_size + other._size;
+					base_ptr pivot = other.unlink_node(other.rightmost());
+					size_type height;
+					reset_root(join_tree(other.root(), get_black_height(other.root()), pivot, root(), get_black_height(root()), height));
+					this->_size = total;
+				}
+				else {
+					join_by_copy(other, unique);
+					return ;
 				}
+				other.set_header(nil(), NULL, NULL);
+				other._size = 0;
+			}
+
+			//노드 n개가 (사용 중인 노드 + slab의 빈 노드)에 준비되도록 부족한 만큼 slab 하나로 할당한다.
+			//이후 넣는 요소는 size()가 n을 넘지 않는 동안 slab의 노드를 쓰므로 insert/erase가 힙 할당을 하지 않는다.
+			void reserve(size_type n) {
+				size_type ready = this->_size + (this->_pool == NULL ? 0 : this->_pool->slab_count);
+				if (n <= ready)
+					return ;
+				add_slab(n - ready);
+			}
+
+			//slab의 노드는 free-list로 돌려놓고, 하나씩 할당한 노드는 해제한다.
+			//slab이 없으면 pool도 해제한다. -> clear 후에는 reserve한 만큼만 메모리를 갖는다.
+			void clear() {
+				destroy_subtree(root(), !has_slabs());
+				set_header(nil(), NULL, NULL);
+				this->_size = 0;
+				trim_free_nodes();
+				if (this->_pool != NULL && this->_pool->slabs == NULL)
+					release_pool();
 			}
 
 			//Operations
-			node_type* find(value_type val) const {
-				node_type* res = this->_root;
-				if (this->_size == 0)
-					return (this->_nil);
-				while (res->value != NULL && (_comp(val, *res->value) || _comp(*res->value, val))) {
-					if (_comp(val, *res->value))
-						res = res->leftChild;
-					else
-						res = res->rightChild;
-				}
-				return (res);
+			//value_type을 만들지 않고 key만으로 탐색한다.
+			base_ptr find(const key_type& k) const {
+				return (find(k, three_way()));
 			}
 
 			// 같은 동작을 하지만, 맵에 va와 같은 키를 가진 요소가 포함되어 있는 경우를 제외하고
 			// lower_bound는 그 요소를 가리키는 반복자를 반환
 			// upper_bound는 다음 요소를 가리키는 반복자를 반환
-			// val보다 크거나 같은 범위를 구하기 위함.
-			node_type* lower_bound(const value_type& val) const {
-				iterator it(get_begin());
-				iterator ite(get_end());
-				while (it != ite && _comp(*it, val))
-					it++;
-				return (it.base());
+			// k보다 크거나 같은 범위를 구하기 위함.
+			// root부터 한 번만 내려가며 k보다 작지 않은 노드를 후보로 기록한다. -> O(log n)
+			base_ptr lower_bound(const key_type& k) const {
+				return (lower_bound(k, root(), header()));
+			}
+
+			base_ptr upper_bound(const key_type& k) const {
+				return (upper_bound(k, root(), header()));
+			}
+
+			//k와 같은 key를 가진 구간 [lower_bound, upper_bound)를 root부터 한 번만 내려가 찾는다.
+			//k와 같은 노드를 처음 만나면 lower_bound는 그 노드의 왼쪽 서브트리에, upper_bound는 오른쪽 서브트리에만 있다.
+			//-> 같은 key가 몇 개이든 O(log n)
+			ft::pair<base_ptr, base_ptr> equal_range(const key_type& k) const {
+				base_ptr node = root();
+				base_ptr upper = header();
+				while (node != nil()) {
+					int res = three_way::compare(get_comp(), k, get_key(node));
+					if (res < 0) {
+						upper = node;
+						node = node->leftChild;
+					}
+					else if (res > 0)
+						node = node->rightChild;
+					else
+						return (ft::make_pair(lower_bound(k, node->leftChild, node), upper_bound(k, node->rightChild, upper)));
+				}
+				return (ft::make_pair(upper, upper));
 			}
 
-			//val보다 큰 범위를 구하는 함수
-			node_type* upper_bound(const value_type& val) const {
-				iterator it(get_begin());
-				iterator ite(get_end());
-				while (it != ite && !_comp(val, *it))
-					it++;
-				return (it.base());
+			//k와 같은 key를 가진 노드의 개수
+			//서브트리 크기가 있으면 구간 양 끝의 위치 차이로 O(log n), 없으면 구간을 세므로 같은 key의 개수만큼 더 든다.
+			size_type count(const key_type& k) const {
+				return (count(k, augmented()));
 			}
 
+			//Order statistics (Augment가 서브트리 크기를 저장할 때만 쓸 수 있다)
+			//중위 순회에서 i번째(0부터) 노드, i >= size()이면 header
+			base_ptr nth(size_type i) const {
+				base_ptr node = root();
+				while (node != nil()) {
+					size_type left = get_subtree_size(node->leftChild);
+					if (i < left)
+						node = node->leftChild;
+					else if (i == left)
+						return (node);
+					else {
+						i -= left + 1;
+						node = node->rightChild;
+					}
+				}
+				return (header());
+			}
+
+			//k보다 작은 key를 가진 노드의 개수 (= lower_bound의 위치)
+			size_type rank(const key_type& k) const {
+				size_type res = 0;
+				base_ptr node = root();
+				while (node != nil()) {
+					if (get_comp()(get_key(node), k)) {
+						res += get_subtree_size(node->leftChild) + 1;
+						node = node->rightChild;
+					}
+					else
+						node = node->leftChild;
+				}
+				return (res);
+			}
+
+			//중위 순회에서 node의 위치, header는 size()
+			//node부터 root까지 올라가며 왼쪽에 있는 서브트리의 크기를 더한다. -> 두 iterator 사이의 거리도 O(log n)
+			size_type get_index(base_ptr node) const {
+				if (node == header())
+					return (this->_size);
+				size_type res = get_subtree_size(node->leftChild);
+				for (base_ptr parent = node->get_parent(); parent != header(); node = parent, parent = parent->get_parent()) {
+					if (node == parent->rightChild)
+						res += get_subtree_size(parent->leftChild) + 1;
+				}
+				return (res);
+			}
+
+			//iterator로 value를 직접 바꾼 뒤 (map의 mapped 값 등) node부터 root까지의 data를 다시 계산한다. O(log n)
+			void refresh(base_ptr node) {
+				if (node != header())
+					update_path(node, 0);
+			}
+
+			//key가 [lo, hi)인 노드의 값을 중위 순회 순서대로 Augment의 monoid로 합친다. O(log n)
+			//두 경계가 갈라지는 노드까지 내려간 뒤, 왼쪽은 lo 이상, 오른쪽은 hi 미만인 부분만 모은다.
+			result_type aggregate(const key_type& lo, const key_type& hi) const {
+				base_ptr node = root();
+				while (node != nil()) {
+					if (get_comp()(get_key(node), lo))
+						node = node->rightChild;
+					else if (!get_comp()(get_key(node), hi))
+						node = node->leftChild;
+					else
+						return (Augment::combine(Augment::combine(aggregate_from(node->leftChild, lo),
+							Augment::lift(get_value(node))), aggregate_until(node->rightChild, hi)));
+				}
+				return (Augment::identity());
+			}
+
+		private:
+			size_type count(const key_type& k, ft::true_type) const {
+				ft::pair<base_ptr, base_ptr> range = equal_range(k);
+				return (get_index(range.second) - get_index(range.first));
+			}
+
+			size_type count(const key_type& k, ft::false_type) const {
+				ft::pair<base_ptr, base_ptr> range = equal_range(k);
+				size_type n = 0;
+				for (base_ptr node = range.first; node != range.second; node = get_next_node(node))
+					n++;
+				return (n);
+			}
+
+			//node를 root로 하는 서브트리에서 key가 lo 이상인 노드의 값을 모은다.
+			//lo 이상인 노드를 만나면 그 노드와 오른쪽 서브트리 전체가 구간에 들어가고, 더 작은 값은 왼쪽에만 있다.
+			result_type aggregate_from(base_ptr node, const key_type& lo) const {
+				result_type res = Augment::identity();
+				while (node != nil()) {
+					if (!get_comp()(get_key(node), lo)) {
+						res = Augment::combine(Augment::combine(Augment::lift(get_value(node)), get_subtree_result(node->rightChild)), res);
+						node = node->leftChild;
+					}
+					else
+						node = node->rightChild;
+				}
+				return (res);
+			}
+
+			//node를 root로 하는 서브트리에서 key가 hi 미만인 노드의 값을 모은다.
+			result_type aggregate_until(base_ptr node, const key_type& hi) const {
+				result_type res = Augment::identity();
+				while (node != nil()) {
+					if (get_comp()(get_key(node), hi)) {
+						res = Augment::combine(res, Augment::combine(get_subtree_result(node->leftChild), Augment::lift(get_value(node))));
+						node = node->rightChild;
+					}
+					else
+						node = node->leftChild;
+				}
+				return (res);
+			}
+
+			//node를 root로 하는 서브트리에서 찾는다. 서브트리에 없으면 res를 반환한다.
+			base_ptr lower_bound(const key_type& k, base_ptr node, base_ptr res) const {
+				while (node != nil()) {
+					if (!get_comp()(get_key(node), k)) {
+						res = node;
+						node = node->leftChild;
+					}
+					else
+						node = node->rightChild;
+				}
+				return (res);
+			}
+
+			//k보다 큰 범위를 구하는 함수
+			//lower_bound와 같은 방식으로 k보다 큰 노드를 후보로 기록한다.
+			base_ptr upper_bound(const key_type& k, base_ptr node, base_ptr res) const {
+				while (node != nil()) {
+					if (get_comp()(k, get_key(node))) {
+						res = node;
+						node = node->leftChild;
+					}
+					else
+						node = node->rightChild;
+				}
+				return (res);
+			}
+
+		public:
 			//test end print map function
-			void showMap() { ft::printMap(_root, 0); }
+			void showMap() { ft::printMap<value_type>(root(), 0); }
 
 		private :
+			//모든 tree가 공유하는 leaf 노드, 주소만 비교하고 값을 쓰지 않는다.
+			static base_ptr nil() {
+				return (RBTreeNodeBase::nil());
+			}
+
+			//tree 안에 들어있는 header 노드의 주소
+			//const 함수에서도 iterator가 가리킬 수 있도록 base_ptr로 반환한다.
+			base_ptr header() const {
+				return (const_cast<base_ptr>(&this->_header));
+			}
+
+			//root는 header의 왼쪽 자식이다. -> 회전 / 삭제에서 root를 따로 갱신하지 않아도 된다.
+			base_ptr& root() const {
+				return (header()->leftChild);
+			}
+
+			//가장 큰 값을 가진 노드 (end의 이전 노드)는 header의 parent에만 저장한다.
+			base_ptr rightmost() const {
+				return (header()->get_parent());
+			}
+
+			key_compare& get_comp() { return (comp_base::get()); }
+			const key_compare& get_comp() const { return (comp_base::get()); }
+
+			node_allocator_type& get_node_alloc() { return (alloc_base::get()); }
+			const node_allocator_type& get_node_alloc() const { return (alloc_base::get()); }
+
+			//노드에 저장된 값에서 key를 꺼낸다.
+			static const key_type& get_key(base_ptr node) {
+				return (KeyOfValue()(get_value(node)));
+			}
+
+			//노드 안에 저장된 값을 반환한다.
+			static value_type& get_value(base_ptr node) {
+				return (static_cast<node_type*>(node)->value);
+			}
+
+			//Augmentation
+			//아래 함수들은 augmented가 true_type일 때만 불린다. (템플릿의 멤버 함수는 부를 때만 만들어진다)
+			static augment_data& get_data(base_ptr node) {
+				return (static_cast<node_type*>(node)->data);
+			}
+
+			//nil은 data가 없으므로 NULL (빈 서브트리)
+			static const augment_data* get_child_data(base_ptr node) {
+				if (node == nil())
+					return (NULL);
+				return (&get_data(node));
+			}
+
+			static size_type get_subtree_size(base_ptr node) {
+				if (node == nil())
+					return (0);
+				return (get_data(node).size);
+			}
+
+			static result_type get_subtree_result(base_ptr node) {
+				if (node == nil())
+					return (Augment::identity());
+				return (Augment::get_result(get_data(node)));
+			}
+
+			//node의 data를 value와 두 자식의 data로 다시 계산한다.
+			void update_node(base_ptr node) {
+				update_node(node, augmented());
+			}
+
+			void update_node(base_ptr, ft::false_type) {}
+
+			void update_node(base_ptr node, ft::true_type) {
+				Augment::update(get_data(node), get_value(node), get_child_data(node->leftChild), get_child_data(node->rightChild));
+			}
+
+			//node 아래의 노드 수가 diff(+1 / -1 / 0)만큼 바뀐 뒤 node부터 root까지의 data를 맞춘다. O(log n)
+			//size만 저장하면 (size_only) 형제 노드를 읽지 않고 개수만 더한다. 아니면 노드마다 다시 계산한다.
+			void update_path(base_ptr node, int diff) {
+				update_path(node, diff, augmented());
+			}
+
+			void update_path(base_ptr, int, ft::false_type) {}
+
+			void update_path(base_ptr node, int diff, ft::true_type) {
+				for (; node != header(); node = node->get_parent()) {
+					if (Augment::size_only::value)
+						get_data(node).size += diff;
+					else
+						update_node(node, ft::true_type());
+				}
+			}
+
+			//node 아래의 서브트리가 바뀐 뒤 (join) node부터 root까지 노드마다 data를 다시 계산한다.
+			void recompute_path(base_ptr node) {
+				recompute_path(node, augmented());
+			}
+
+			void recompute_path(base_ptr, ft::false_type) {}
+
+			void recompute_path(base_ptr node, ft::true_type) {
+				for (; node != header(); node = node->get_parent())
+					update_node(node, ft::true_type());
+			}
+
+			//src의 서브트리를 dst가 그대로 받을 때 data도 옮긴다.
+			void copy_data(base_ptr, base_ptr, ft::false_type) {}
+
+			void copy_data(base_ptr dst, base_ptr src, ft::true_type) {
+				get_data(dst) = get_data(src);
+			}
+
+			//value를 만든 노드에 data를 만든다. 실패하면 value를 소멸시키고 노드를 돌려놓는다.
+			void construct_data(node_type*, ft::false_type) {}
+
+			void construct_data(node_type* node, ft::true_type) {
+				try {
+					::new (static_cast<void*>(&node->data)) augment_data();
+				}
+				catch (...) {
+					allocator_type(get_node_alloc()).destroy(&node->value);
+					put_node(node);
+					throw;
+				}
+			}
+
+			void destroy_data(node_type*, ft::false_type) {}
+
+			void destroy_data(node_type* node, ft::true_type) {
+				node->data.~augment_data();
+			}
+
 			//노드의 조상노드을 반환한다.
-			node_type* get_grandparent(node_type* node) const {
-				if (node != NULL && node->parent != NULL)
-					return (node->parent->parent);
+			base_ptr get_grandparent(base_ptr node) const {
+				if (node != NULL && node->get_parent() != NULL)
+					return (node->get_parent()->get_parent());
 				else
 					return (NULL);
 			}
 
 			//노드의 삼촌노드를 반환한다.
-			node_type* get_uncle(node_type* node) const {
-				node_type* grand = get_grandparent(node);
+			base_ptr get_uncle(base_ptr node) const {
+				base_ptr grand = get_grandparent(node);
 				if (grand == NULL)
 					return (NULL);
-				if (grand->leftChild == node->parent)
+				if (grand->leftChild == node->get_parent())
 					return (grand->rightChild);
 				else
 					return (grand->leftChild);
 			}
 
 			//노드의 형제노드를 반환한다.
-			node_type* get_sibling(node_type* node) const {
-				if (node == node->parent->leftChild)
-					return (node->parent->rightChild);
+			//node가 nil일 수 있으므로 부모는 따로 받는다.
+			base_ptr get_sibling(base_ptr node, base_ptr parent) const {
+				if (node == parent->leftChild)
+					return (parent->rightChild);
 				else
-					return (node->parent->leftChild);
-			}
-
-			//tree에서 가장 큰 값을 가지는 노드를 찾는다.
-			//tree에서 가장 오른쪽에 있는 값이 가장 큰 값이다.
-			node_type* get_max_value_node() const {
-				node_type* tmp = _root;
-				while (tmp->rightChild->value != NULL)
-					tmp = tmp->rightChild;
-				return (tmp);
-			}
-
-			//nil 노드를 만든다.
-			//아무런 값이 없는 노드, tree의 leat노드이다.
-			node_type* make_nil() {
-				node_type* res = _node_alloc.allocate(1);
-				_node_alloc.construct(res, node_type());
-				res->color = BLACK;
-				res->leftChild = res;
-				res->rightChild = res;
-				res->parent = res;
-				res->value = NULL;
-				return (res);
+					return (parent->leftChild);
+			}
+
+			//중위 순회에서 node의 다음 노드를 찾는다. 없으면 header를 반환한다.
+			base_ptr get_next_node(base_ptr node) const {
+				if (node->rightChild != nil()) {
+					node = node->rightChild;
+					while (node->leftChild != nil())
+						node = node->leftChild;
+					return (node);
+				}
+				base_ptr parent = node->get_parent();
+				while (parent != header() && node == parent->rightChild) {
+					node = parent;
+					parent = parent->get_parent();
+				}
+				return (parent);
+			}
+
+			//중위 순회에서 node의 이전 노드를 찾는다. 없으면 header를 반환한다.
+			base_ptr get_prev_node(base_ptr node) const {
+				if (node->leftChild != nil()) {
+					node = node->leftChild;
+					while (node->rightChild != nil())
+						node = node->rightChild;
+					return (node);
+				}
+				base_ptr parent = node->get_parent();
+				while (parent != header() && node == parent->leftChild) {
+					node = parent;
+					parent = parent->get_parent();
+				}
+				return (parent);
+			}
+
+			//node를 root로 하는 서브트리에서 가장 작은 / 큰 값을 가진 노드를 찾는다.
+			base_ptr get_min_node(base_ptr node) const {
+				while (node->leftChild != nil())
+					node = node->leftChild;
+				return (node);
+			}
+
+			base_ptr get_max_node(base_ptr node) const {
+				while (node->rightChild != nil())
+					node = node->rightChild;
+				return (node);
+			}
+
+			//header 노드를 new_root의 tree에 맞게 연결한다.
+			//아무런 값이 없는 노드, end()가 가리키는 노드이다.
+			//비어있을 때는 root가 nil이고, 가장 왼쪽 / 오른쪽 노드 자리는 자기 자신이다.
+			void set_header(base_ptr new_root, base_ptr leftmost, base_ptr rightmost) {
+				header()->leftChild = new_root;
+				header()->rightChild = header();
+				if (new_root == nil()) {
+					this->_leftmost = header();
+					header()->set_parent(header());
+				}
+				else {
+					new_root->set_parent(header());
+					this->_leftmost = leftmost;
+					header()->set_parent(rightmost);
+				}
 			}
 
 			//value 값을 가지는 노드를 만든다.
+			//노드 하나만 할당하고, 그 안의 value 자리에 val을 한 번만 복사한다.
 			//노드의 색/자식/부모는 삽입 후 tree의 속성에 맞게 재조정 후 결정한다.
-			node_type* make_node(const value_type& val) {
-				node_type* res = _node_alloc.allocate(1);
-				_node_alloc.construct(res, node_type(val));
+#if __cplusplus >= 201103L
+			//c++11 이상은 인자를 그대로 넘겨 value 자리에 바로 생성한다. (move / emplace)
+			template <typename... Args>
+			base_ptr make_node(Args&&... args) {
+				node_type* res = get_node();
+				try {
+					allocator_type alloc(get_node_alloc());
+					std::allocator_traits<allocator_type>::construct(alloc, &res->value, std::forward<Args>(args)...);
+				}
+#else
+			base_ptr make_node(const value_type& val) {
+				node_type* res = get_node();
+				try {
+					allocator_type(get_node_alloc()).construct(&res->value, val);
+				}
+#endif
+				catch (...) {
+					put_node(res);
+					throw;
+				}
+				construct_data(res, augmented());
+				res->set_parent(nil());
+				res->set_color(RED);
+				res->leftChild = nil();
+				res->rightChild = nil();
 				return (res);
 			}
 
+			//src를 root로 하는 서브트리를 복제하여 parent 아래에 붙일 root를 반환한다.
+			//복사 도중 예외가 발생하면 지금까지 만든 노드를 정리하고 다시 던진다.
+			base_ptr clone_node(base_ptr src, base_ptr parent) {
+				base_ptr res = make_node(get_value(src));
+				res->set_color(src->get_color());
+				res->set_parent(parent);
+				this->_size++;
+				try {
+					if (src->leftChild != nil())
+						res->leftChild = clone_node(src->leftChild, res);
+					if (src->rightChild != nil())
+						res->rightChild = clone_node(src->rightChild, res);
+				}
+				catch (...) {
+					this->_size -= destroy_subtree(res, false);
+					throw;
+				}
+				update_node(res);
+				return (res);
+			}
+
+			//정렬된 구간에서 n개를 읽어 균형잡힌 서브트리를 만들고 root를 반환한다.
+			//왼쪽 서브트리, 자기 자신, 오른쪽 서브트리 순서로 만들어 it을 한 번만 전진시킨다.
+			//예외가 발생하면 지금까지 만든 노드를 정리하고 다시 던진다.
+			template <typename ForwardIterator>
+			base_ptr build_node(ForwardIterator& it, size_type n, size_type depth, size_type red_depth) {
+				if (n == 0)
+					return (nil());
+				size_type left_n = (n - 1) / 2;
+				base_ptr left = build_node(it, left_n, depth + 1, red_depth);
+				base_ptr res;
+				try {
+					res = make_node(*it);
+				}
+				catch (...) {
+					this->_size -= destroy_subtree(left, false);
+					throw;
+				}
+				++it;
+				this->_size++;
+				res->set_color((depth == red_depth) ? RED : BLACK);
+				res->leftChild = left;
+				if (left != nil())
+					left->set_parent(res);
+				try {
+					res->rightChild = build_node(it, n - 1 - left_n, depth + 1, red_depth);
+				}
+				catch (...) {
+					this->_size -= destroy_subtree(res, false);
+					throw;
+				}
+				if (res->rightChild != nil())
+					res->rightChild->set_parent(res);
+				update_node(res);
+				return (res);
+			}
+
+			//node를 root로 하는 서브트리의 노드를 모두 지우고 지운 개수를 반환한다. (tree의 size, header는 그대로 둔다)
+			//재귀 없이 O(1) 공간으로 지운다.
+			//왼쪽 자식이 있으면 오른쪽으로 회전해 왼쪽 자식을 위로 올리고, 없으면 자신을 지우고 오른쪽 자식으로 간다.
+			//회전할 때마다 노드 하나가 왼쪽 자식이 없는 자리로 옮겨지므로 회전은 n번을 넘지 않는다. -> O(n)
+			//지울 노드의 parent, 색은 다시 쓰지 않는다.
+			//release - true이면 free-list에 넣지 않고 바로 해제한다. (slab에서 받은 노드가 없을 때만)
+			size_type destroy_subtree(base_ptr node, bool release) {
+				size_type n = 0;
+				while (node != nil()) {
+					base_ptr left = node->leftChild;
+					if (left != nil()) {
+						node->leftChild = left->rightChild;
+						left->rightChild = node;
+						node = left;
+					}
+					else {
+						base_ptr right = node->rightChild;
+						if (release) {
+							node_type* res = static_cast<node_type*>(node);
+							allocator_type(get_node_alloc()).destroy(&res->value);
+							destroy_data(res, augmented());
+							get_node_alloc().deallocate(res, 1);
+						}
+						else
+							destroy_node(node);
+						node = right;
+						n++;
+					}
+				}
+				return (n);
+			}
+
+			//value(와 data)를 소멸시키고 노드를 free-list에 돌려놓는다.
+			void destroy_node(base_ptr node) {
+				node_type* res = static_cast<node_type*>(node);
+				allocator_type(get_node_alloc()).destroy(&res->value);
+				destroy_data(res, augmented());
+				put_node(res);
+			}
+
+			//free-list에 노드가 있으면 꺼내 쓰고 (slab의 노드 먼저), 없을 때만 새로 할당한다.
+			node_type* get_node() {
+				node_pool* pool = this->_pool;
+				if (pool != NULL && pool->slab_nodes != NULL) {
+					node_type* res = static_cast<node_type*>(pool->slab_nodes);
+					pool->slab_nodes = res->leftChild;
+					pool->slab_count--;
+					return (res);
+				}
+				if (pool != NULL && pool->free_nodes != NULL) {
+					node_type* res = static_cast<node_type*>(pool->free_nodes);
+					pool->free_nodes = res->leftChild;
+					pool->free_count--;
+					return (res);
+				}
+				return (get_node_alloc().allocate(1));
+			}
+
+			//value가 없는 노드를 free-list 앞에 넣는다. (leftChild로 연결)
+			//slab의 노드는 항상 slab의 free-list로 돌아간다.
+			//하나씩 할당한 노드는 free-list가 사용 중인 노드 수보다 적을 때만 넣고, 아니면 해제한다.
+			//-> 크기가 일정한 tree는 노드를 계속 재사용하고, 줄어든 tree는 사용 중인 노드의 두 배 이상 메모리를 갖지 않는다.
+			void put_node(node_type* node) {
+				node_pool* pool = this->_pool;
+				if (pool != NULL && pool->slabs != NULL && is_slab_node(node)) {
+					node->leftChild = pool->slab_nodes;
+					pool->slab_nodes = node;
+					pool->slab_count++;
+					return ;
+				}
+				if (pool == NULL || pool->free_count < this->_size) {
+					pool = get_pool();
+					if (pool != NULL) {
+						node->leftChild = pool->free_nodes;
+						pool->free_nodes = node;
+						pool->free_count++;
+						return ;
+					}
+				}
+				get_node_alloc().deallocate(node, 1);
+				if (pool != NULL && pool->free_count > this->_size) {
+					node_type* extra = static_cast<node_type*>(pool->free_nodes);
+					pool->free_nodes = extra->leftChild;
+					pool->free_count--;
+					get_node_alloc().deallocate(extra, 1);
+				}
+			}
+
+			//하나씩 할당한 노드 중 사용 중인 노드 수를 넘는 만큼 해제한다.
+			void trim_free_nodes() {
+				node_pool* pool = this->_pool;
+				while (pool != NULL && pool->free_count > this->_size) {
+					node_type* node = static_cast<node_type*>(pool->free_nodes);
+					pool->free_nodes = node->leftChild;
+					pool->free_count--;
+					get_node_alloc().deallocate(node, 1);
+				}
+			}
+
+			bool has_slabs() const {
+				return (this->_pool != NULL && this->_pool->slabs != NULL);
+			}
+
+			//node가 reserve로 받은 slab 안에 있는지 확인한다. (slab은 reserve를 부른 횟수만큼 있다)
+			bool is_slab_node(node_type* node) const {
+				for (base_ptr slab = this->_pool->slabs; slab != NULL; slab = slab->leftChild) {
+					if (static_cast<node_type*>(slab) < node && node < slab->rightChild)
+						return (true);
+				}
+				return (false);
+			}
+
+			//pool이 없으면 만든다. 지우는 도중에도 부르므로 할당에 실패하면 던지지 않고 NULL을 반환한다.
+			node_pool* get_pool() {
+				if (this->_pool == NULL) {
+					try {
+						this->_pool = pool_allocator_type(get_node_alloc()).allocate(1);
+					}
+					catch (...) {
+						return (NULL);
+					}
+					this->_pool->free_nodes = NULL;
+					this->_pool->free_count = 0;
+					this->_pool->slab_nodes = NULL;
+					this->_pool->slab_count = 0;
+					this->_pool->slabs = NULL;
+				}
+				return (this->_pool);
+			}
+
+			//n개의 노드를 한 번에 할당해 slab의 free-list에 넣는다.
+			//첫 노드는 header로, leftChild에 다음 slab을, rightChild에 slab의 끝을 기록한다.
+			void add_slab(size_type n) {
+				node_pool* pool = get_pool();
+				if (pool == NULL)
+					throw (std::bad_alloc());
+				node_type* slab = get_node_alloc().allocate(n + 1);
+				slab->leftChild = pool->slabs;
+				slab->rightChild = slab + n + 1;
+				pool->slabs = slab;
+				for (size_type i = n; i > 0; --i) {
+					slab[i].leftChild = pool->slab_nodes;
+					pool->slab_nodes = slab + i;
+				}
+				pool->slab_count += n;
+			}
+
+			//free-list의 노드와 slab, pool을 모두 해제한다. (tree는 비어있어야 한다)
+			//하나씩 할당한 노드는 하나씩, slab의 노드는 slab과 같이 통째로 해제한다.
+			void release_pool() {
+				node_pool* pool = this->_pool;
+				if (pool == NULL)
+					return ;
+				while (pool->free_nodes != NULL) {
+					base_ptr node = pool->free_nodes;
+					pool->free_nodes = node->leftChild;
+					get_node_alloc().deallocate(static_cast<node_type*>(node), 1);
+				}
+				while (pool->slabs != NULL) {
+					node_type* slab = static_cast<node_type*>(pool->slabs);
+					pool->slabs = slab->leftChild;
+					get_node_alloc().deallocate(slab, static_cast<node_type*>(slab->rightChild) - slab);
+				}
+				pool_allocator_type(get_node_alloc()).deallocate(pool, 1);
+				this->_pool = NULL;
+			}
+
 			/**
 			 * Hint 쓰는 경우. (hint가 적절한 위치인 경우)
-			 * inserted value는 hint node의 right-sub-tree로 들어간다.
-			 * 공통 조건 :  hint < inserted value 인 경우.
-			 * 1) hint가 leftChild인 경우, inserted value < hint-parent 이면, hint부터 탐색.
-			 * 2) hint가 rightChild인 경우, parent를 따라가다가 처음으로 leftChild인  d노드의 parent보다 작으면 hint부터 탐색.
+			 * k가 hint 바로 앞(이전 노드와 hint 사이) 또는 바로 뒤(hint와 다음 노드 사이)에 들어가면
+			 * root부터 탐색하지 않고 두 노드 중 비어있는 자식 자리에 바로 붙인다.
+			 * 1) hint가 end(header)인 경우, k가 가장 큰 값보다 크면 rightmost의 오른쪽 자식
+			 * 2) k < hint 인 경우, 이전 노드 < k 이면 이전 노드의 오른쪽 또는 hint의 왼쪽 자식
+			 * 3) hint < k 인 경우, k < 다음 노드 이면 hint의 오른쪽 또는 다음 노드의 왼쪽 자식
+			 * 4) k == hint 인 경우, 삽입 불가
+			 * 중위 순회에서 이웃한 두 노드는 둘 중 하나가 반드시 그 사이 자리가 비어있다.
+			 * 이전/다음 노드를 찾는 비용은 연속으로 삽입할 때 상수로 상각되므로, end()에 오름차순으로 넣으면 O(1)이다.
+			 * hint가 맞지 않으면 (NULL, false)를 반환하고 root부터 탐색한다.
 			 */
-			node_type* check_hint(value_type val, node_type* hint) {
-				if (_comp(*hint->value, *_root->value) && _comp(val, *hint->value))
-					return (hint);
-				else if (_comp(*hint->value, *_root->value) && _comp(*hint->value, val))
-					return (_root);
-				else if (_comp(*_root->value, *hint->value) && _comp(val, *hint->value))
-					return (_root);
-				else if (_comp(*_root->value, *hint->value) && _comp(*hint->value, val))
-					return (hint);
+			ft::pair<base_ptr, bool> check_hint(const key_type& k, base_ptr hint, bool& is_left) {
+				if (hint == header()) {
+					if (get_comp()(get_key(rightmost()), k)) {
+						is_left = false;
+						return (ft::make_pair(rightmost(), true));
+					}
+				}
+				else if (get_comp()(k, get_key(hint))) {
+					if (hint == this->_leftmost) {
+						is_left = true;
+						return (ft::make_pair(hint, true));
+					}
+					base_ptr prev = get_prev_node(hint);
+					if (get_comp()(get_key(prev), k)) {
+						is_left = (prev->rightChild != nil());
+						return (ft::make_pair(is_left ? hint : prev, true));
+					}
+				}
+				else if (get_comp()(get_key(hint), k)) {
+					if (hint == rightmost()) {
+						is_left = false;
+						return (ft::make_pair(hint, true));
+					}
+					base_ptr next = get_next_node(hint);
+					if (get_comp()(k, get_key(next))) {
+						is_left = (hint->rightChild != nil());
+						return (ft::make_pair(is_left ? next : hint, true));
+					}
+				}
 				else
-					return (_root);
+					return (ft::make_pair(hint, false));
+				return (ft::make_pair(static_cast<base_ptr>(NULL), false));
+			}
+
+			//three-way 비교 - 노드마다 한 번 비교하고, 같은 key를 만나면 바로 반환한다.
+			base_ptr find(const key_type& k, ft::true_type) const {
+				base_ptr node = root();
+				while (node != nil()) {
+					int res = three_way::compare(get_comp(), k, get_key(node));
+					if (res == 0)
+						return (node);
+					node = (res < 0) ? node->leftChild : node->rightChild;
+				}
+				return (header());
+			}
+
+			//less만 있는 경우 - lower_bound로 내려간 뒤 찾은 노드가 k와 같은지 한 번만 확인한다.
+			//노드마다 비교 1번 + 마지막 1번
+			base_ptr find(const key_type& k, ft::false_type) const {
+				base_ptr res = lower_bound(k);
+				if (res == header() || get_comp()(k, get_key(res)))
+					return (header());
+				return (res);
+			}
+
+			//같은 key를 허용할 때 k가 들어갈 부모 노드를 찾는다. is_left에 부모의 어느 쪽 자식이 될지 기록한다.
+			//hint가 없거나 맞지 않으면 k보다 큰 첫 노드(upper_bound) 바로 앞 자리에 넣도록 내려간다.
+			//단, hint < k 인데 맞지 않은 경우는 hint에 가까운 쪽인 같은 key들의 가장 앞(lower_bound) 자리에 넣는다.
+			//tree가 비어있으면 부모는 header이다.
+			base_ptr get_equal_position(const key_type& k, base_ptr hint, bool& is_left) const {
+				is_left = true;
+				if (root() == nil())
+					return (header());
+				bool lower = false;
+				if (hint != NULL) {
+					base_ptr res = check_equal_hint(k, hint, is_left);
+					if (res != NULL)
+						return (res);
+					lower = (hint != header() && get_comp()(get_key(hint), k));
+				}
+				base_ptr node = root();
+				base_ptr parent;
+				do {
+					parent = node;
+					is_left = lower ? !get_comp()(get_key(node), k) : get_comp()(k, get_key(node));
+					node = is_left ? node->leftChild : node->rightChild;
+				} while (node != nil());
+				return (parent);
+			}
+
+			/**
+			 * 같은 key를 허용할 때의 hint
+			 * 1) hint가 end(header)인 경우, k가 가장 큰 값보다 작지 않으면 rightmost의 오른쪽 자식
+			 * 2) k <= hint 인 경우, 이전 노드 <= k 이면 이전 노드의 오른쪽 또는 hint의 왼쪽 자식 (hint 바로 앞)
+			 * 3) hint < k 인 경우, k <= 다음 노드 이면 hint의 오른쪽 또는 다음 노드의 왼쪽 자식
+			 * hint가 맞지 않으면 NULL을 반환하고 root부터 탐색한다.
+			 */
+			base_ptr check_equal_hint(const key_type& k, base_ptr hint, bool& is_left) const {
+				if (hint == header()) {
+					if (!get_comp()(k, get_key(rightmost()))) {
+						is_left = false;
+						return (rightmost());
+					}
+				}
+				else if (!get_comp()(get_key(hint), k)) {
+					if (hint == this->_leftmost) {
+						is_left = true;
+						return (hint);
+					}
+					base_ptr prev = get_prev_node(hint);
+					if (!get_comp()(k, get_key(prev))) {
+						is_left = (prev->rightChild != nil());
+						return (is_left ? hint : prev);
+					}
+				}
+				else {
+					if (hint == rightmost()) {
+						is_left = false;
+						return (hint);
+					}
+					base_ptr next = get_next_node(hint);
+					if (!get_comp()(get_key(next), k)) {
+						is_left = (hint->rightChild != nil());
+						return (is_left ? next : hint);
+					}
+				}
+				return (NULL);
 			}
 
 			//노드를 삽입할 위치를 탐색하는 함수이다.
 			//make_pair로 한 쌍의 pair를 만든 후 삽입이 가능한지 true/false를 반환한다.
-			ft::pair<node_type*, bool> get_position(node_type* position, node_type* node) {
-				while (position->value != NULL) {
+			ft::pair<base_ptr, bool> get_position(base_ptr position, const key_type& k, bool& is_left) const {
+				return (get_position(position, k, is_left, three_way()));
+			}
+
+			//less만 있는 경우 - 노드마다 k < node 만 확인하며 nil까지 내려간다.
+			//같은 key가 있다면 k보다 작거나 같은 노드 중 가장 큰 노드(마지막으로 오른쪽으로 간 노드)뿐이므로 그 노드만 한 번 더 비교한다.
+			ft::pair<base_ptr, bool> get_position(base_ptr position, const key_type& k, bool& is_left, ft::false_type) const {
+				base_ptr parent;
+				do {
+					parent = position;
+					is_left = get_comp()(k, get_key(position));
+					position = is_left ? position->leftChild : position->rightChild;
+				} while (position != nil());
+				base_ptr prev = parent;
+				if (is_left) {
+					if (parent == this->_leftmost)
+						return (ft::make_pair(parent, true));
+					prev = get_prev_node(parent);
+				}
+				if (get_comp()(get_key(prev), k))
+					return (ft::make_pair(parent, true));
+				return (ft::make_pair(prev, false));
+			}
+
+			//three-way 비교 - 노드마다 한 번 비교한다.
+			ft::pair<base_ptr, bool> get_position(base_ptr position, const key_type& k, bool& is_left, ft::true_type) const {
+				while (true) {
+					int res = three_way::compare(get_comp(), k, get_key(position));
 					//position을 기준으로 leftchild로 들어감
-					if (_comp(*node->value, *position->value)) {
-						if (position->leftChild->value == NULL) {
-							position->leftChild = node;
-							node->parent = position;
-							node->leftChild = _nil;
-							node->rightChild = _nil;
-							node->color = RED;
+					if (res < 0) {
+						if (position->leftChild == nil()) {
+							is_left = true;
 							break;
 						}
-						else
-							position = position->leftChild;
+						position = position->leftChild;
 					}
 					//position을 기준으로 rightchild로 들어감
-					else if (_comp(*position->value, *node->value)) {
-						if (position->rightChild->value == NULL) {
-							position->rightChild = node;
-							node->parent = position;
-							node->leftChild = _nil;
-							node->rightChild = _nil;
-							node->color = RED;
+					else if (res > 0) {
+						if (position->rightChild == nil()) {
+							is_left = false;
 							break;
 						}
-						else
-							position = position->rightChild;
+						position = position->rightChild;
 					}
 					else
 						return (ft::make_pair(position, false));
@@ -368,33 +1342,33 @@ namespace ft {
 			 * ->node의 leftChild가 없으면, 오른쪽 서브트리에서 최솟값을 찾는다.
 			 * 찾은 값의 value를 node에 복사하고, 찾은 그 노드는 삭제해야 하므로 리턴한다.
 			 */
-			node_type* replace_erase_node(node_type* node) {
-				node_type* res;
-				if (node->leftChild->value != NULL) {
+			base_ptr replace_erase_node(base_ptr node) {
+				base_ptr res;
+				if (node->leftChild != nil()) {
 					res = node->leftChild;
-					while (res->rightChild->value != NULL)
+					while (res->rightChild != nil())
 						res = res->rightChild;
 				}
-				else if (node->rightChild->value != NULL) {
+				else if (node->rightChild != nil()) {
 					res = node->rightChild;
-					while (res->leftChild->value != NULL)
+					while (res->leftChild != nil())
 						res = res->leftChild;
 				}
 				else
 					return (node);
 
-				node_type* tmp_parent = node->parent;
-				node_type* tmp_left = node->leftChild;
-				node_type* tmp_right = node->rightChild;
-				RBColor tmp_color = node->color;
+				base_ptr tmp_parent = node->get_parent();
+				base_ptr tmp_left = node->leftChild;
+				base_ptr tmp_right = node->rightChild;
+				RBColor tmp_color = node->get_color();
 
 				//node의 left/rightChild 설정
 				node->leftChild = res->leftChild;
-				if (res->leftChild->value != NULL)
-					res->leftChild->parent = node;
+				if (res->leftChild != nil())
+					res->leftChild->set_parent(node);
 				node->rightChild = res->rightChild;
-				if (res->rightChild->value != NULL)
-					res->rightChild->parent = node;
+				if (res->rightChild != nil())
+					res->rightChild->set_parent(node);
 
 				//res를 node->parent의 left/rightChild로 설정
 				if (tmp_parent->leftChild == node)
@@ -402,107 +1376,110 @@ namespace ft {
 				else if (tmp_parent->rightChild == node)
 					tmp_parent->rightChild = res;
 
+				//nil에는 parent를 쓰지 않는다.
 				if (res == tmp_left) {
 					//res의 형제를 res의 left/rightChild로 연결
-					tmp_right->parent = res;
+					if (tmp_right != nil())
+						tmp_right->set_parent(res);
 					res->rightChild = tmp_right;
 					//node를 res의 left/rightChild로 연결
-					node->parent = res;
+					node->set_parent(res);
 					res->leftChild = node;
 				}
 				else if (res == tmp_right) {
-					tmp_left->parent = res;
+					if (tmp_left != nil())
+						tmp_left->set_parent(res);
 					res->leftChild = tmp_left;
-					node->parent = res;
+					node->set_parent(res);
 					res->rightChild = node;
 				}
 				else {
-					//res와 node가 멀리 떨어진 경우
-					tmp_left->parent = res;
+					//res와 node가 멀리 떨어진 경우 (res는 왼쪽 서브트리에 있으므로 tmp_left는 nil이 아니다)
+					tmp_left->set_parent(res);
 					res->leftChild = tmp_left;
-					tmp_right->parent = res;
+					if (tmp_right != nil())
+						tmp_right->set_parent(res);
 					res->rightChild = tmp_right;
-					node->parent = res->parent;
-					res->parent->rightChild = node;
+					node->set_parent(res->get_parent());
+					res->get_parent()->rightChild = node;
 				}
 
 				//res의 parent 연결
-				res->parent = tmp_parent;
-
-				if (res->parent->value == NULL)
-					this->_root = res;
-				node->color = res->color;
-				res->color = tmp_color;
+				//node가 root였다면 header의 leftChild가 위에서 res로 바뀐다.
+				res->set_parent(tmp_parent);
+				node->set_color(res->get_color());
+				res->set_color(tmp_color);
+				//res는 node의 서브트리를 그대로 받으므로 data도 받는다. (node는 곧 지워진다)
+				copy_data(res, node, augmented());
 
 				return (node);
 			}
 
-			void replace_node(node_type* node, node_type* child) {
-				//노드의 부모가 NULL이 되는 경우를 delete_case에 오지 않게 미리 처리할 수 있다.
-				child->parent = node->parent;
-				if (node->parent->leftChild == node)
-					node->parent->leftChild = child;
-				else// if (node->parent->rightChild == node)
-					node->parent->rightChild = child;
+			//node 자리에 child를 연결한다. child가 nil이면 parent를 기록하지 않는다.
+			void replace_node(base_ptr node, base_ptr child) {
+				if (child != nil())
+					child->set_parent(node->get_parent());
+				if (node->get_parent()->leftChild == node)
+					node->get_parent()->leftChild = child;
+				else// if (node->get_parent()->rightChild == node)
+					node->get_parent()->rightChild = child;
 			}
 
 			//rotate
 			//child가 node의 오른쪽 자식일 경우 rotate_left를 한다.
-			void rotate_left(node_type* node) {
-				node_type* child = node->rightChild;
-				node_type* parent = node->parent;
+			void rotate_left(base_ptr node) {
+				base_ptr child = node->rightChild;
+				base_ptr parent = node->get_parent();
 				//node를 기준으로 왼쪽으로 회전하는 경우
-				if (child->leftChild->value != NULL)
-					child->leftChild->parent = node;
+				if (child->leftChild != nil())
+					child->leftChild->set_parent(node);
 				node->rightChild = child->leftChild;
-				node->parent = child;
+				node->set_parent(child);
 				child->leftChild = node;
-				child->parent = parent;
+				child->set_parent(parent);
 				//node가 부모의 왼쪽 자식인지 오른쪽 자식인지 판단.
-				if (parent->value != NULL) {
-					if (parent->leftChild == node)
-						parent->leftChild = child;
-					else
-						parent->rightChild = child;
-				}
+				//node가 root이면 parent는 header이고, header의 leftChild(root)가 바뀐다.
+				if (parent->leftChild == node)
+					parent->leftChild = child;
 				else
-					this->_root = child;
+					parent->rightChild = child;
+				//서브트리가 바뀐 노드는 node(이제 child의 자식)와 child뿐이다.
+				update_node(node);
+				update_node(child);
 			}
 
 			//child가 node의 오른쪽 자식일 경우 rotate_left를 한다.
-			void rotate_right(node_type* node) {
-				node_type* child = node->leftChild;
-				node_type* parent = node->parent;
-				if (child->rightChild->value != NULL)
-					child->rightChild->parent = node;
+			void rotate_right(base_ptr node) {
+				base_ptr child = node->leftChild;
+				base_ptr parent = node->get_parent();
+				if (child->rightChild != nil())
+					child->rightChild->set_parent(node);
 				node->leftChild = child->rightChild;
-				node->parent = child;
+				node->set_parent(child);
 				child->rightChild = node;
-				child->parent = parent;
-				if (parent->value != NULL) {
-					if (parent->rightChild == node)
-						parent->rightChild = child;
-					else
-						parent->leftChild = child;
-				}
+				child->set_parent(parent);
+				if (parent->rightChild == node)
+					parent->rightChild = child;
 				else
-					this->_root = child;
+					parent->leftChild = child;
+				update_node(node);
+				update_node(child);
 			}
 
 			// 삽입된 새로운 노드가 root노드가 아닌 경우
-			void insert_case1(node_type* node) {
-				if (node->parent->value != NULL)
+			void insert_case1(base_ptr node) {
+				if (node->get_parent() != header())
 					insert_case2(node);
 				else
-					node->color = BLACK;
+					node->set_color(BLACK);
 			}
 
 			// 새로운 노드의 부모 노드가 black이라면,
 			// 새로운 노드가 black/red 상관없이 rbtree 속성이 유효하다.
 			// 삽입된 새로운 노드의 부모 노드가 red일 때, 문제가 발생할 수 있다.
 			// 삽입되는 새로운 노드의 색은 항상 red
-			void insert_case2(node_type* node) {
-				if (node->parent->color == RED)
+			void insert_case2(base_ptr node) {
+				if (node->get_parent()->get_color() == RED)
 					insert_case3(node);
 			}
 
@@ -512,14 +1489,14 @@ namespace ft {
 			// 이 경우 조상 노드가 2/4번 속성을 만족하지 않을 수 있다.
 			// 이를 해결하기 위해 insert_case1~3 까지 재귀적으로 활용한다.
 			// -> 이 작업은 삽입과정 중 발생하는 유일한 재귀 호출이며, 회전을 하기 전에 적용해야한다.
-			void insert_case3(node_type* node) {
-				node_type* uncle = get_uncle(node);
-				node_type* grand;
-				if (uncle->value != NULL && uncle->color == RED) {
-					node->parent->color = BLACK;
-					uncle->color = BLACK;
+			void insert_case3(base_ptr node) {
+				base_ptr uncle = get_uncle(node);
+				base_ptr grand;
+				if (uncle != nil() && uncle->get_color() == RED) {
+					node->get_parent()->set_color(BLACK);
+					uncle->set_color(BLACK);
 					grand = get_grandparent(node);
-					grand->color = RED;
+					grand->set_color(RED);
 					insert_case1(grand);
 				}
 				else
@@ -535,15 +1512,15 @@ namespace ft {
 			// insert_case4를 통해 rotate를 한 후 부모 노드를 insert_case5에서 처리하게 된다.
 			// -> 4번 속성을 만족하기 않았기 떄문
 			// If new_node's parent is red and uncle is black,
-			void insert_case4(node_type* node) {
-				node_type* grand = get_grandparent(node);
+			void insert_case4(base_ptr node) {
+				base_ptr grand = get_grandparent(node);
 				// new_node is parent's rightChild and parent is grand's leftChild,
-				if (node == node->parent->rightChild && node->parent == grand->leftChild) {
-					rotate_left(node->parent);
+				if (node == node->get_parent()->rightChild && node->get_parent() == grand->leftChild) {
+					rotate_left(node->get_parent());
 					node = node->leftChild;
 				} // new_node is parent's leftChild and parent is grand's rightChild,
-				else if (node == node->parent->leftChild && node->parent == grand->rightChild) {
-					rotate_right(node->parent);
+				else if (node == node->get_parent()->leftChild && node->get_parent() == grand->rightChild) {
+					rotate_right(node->get_parent());
 					node = node->rightChild;
 				}
 				insert_case5(node);
@@ -555,11 +1532,11 @@ namespace ft {
 			// -> 부모 노드가 red, 조상 노드가 black이므로 둘의 색을 바꾸면 4번 속성을 만족한다.
 			// 5번 속성이 유지되는 이유는 부모 노드를 포함하는 경로는 모드 조상 노드를 지나게 되고,
 			// 바꾼 후 조상 노드를 포함하는 경로는 모두 부모 노드를 지나기 때문이다.
-			void insert_case5(node_type* node) {
-				node_type* grand = get_grandparent(node);
-				node->parent->color = BLACK;
-				grand->color = RED;
-				if (node == node->parent->leftChild)
+			void insert_case5(base_ptr node) {
+				base_ptr grand = get_grandparent(node);
+				node->get_parent()->set_color(BLACK);
+				grand->set_color(RED);
+				if (node == node->get_parent()->leftChild)
 					rotate_right(grand);
 				else
 					rotate_left(grand);
@@ -567,13 +1544,14 @@ namespace ft {
 
 
 			// 2번 속성을 위반한 case
+			// node는 nil일 수 있으므로 모든 delete_case는 node의 부모를 따로 받는다. (nil의 parent를 쓰거나 읽지 않는다)
 			// 인자로 넘어온 node는 삭제할 노드와 삭제할 노드의 자식을 치환 후, 삭제할 노드의 부모가 된 삭제할 노드의 자식 노드이다.
 			// 치환 후 자식 노드의 부모가 없을 경우, 자식 노드가 root가 되므로 삭제할 노드를 그냥 삭제하면 된다.
 
 			// 이 경우가 아닌 경우, delete_case2로 넘어간다.
-			void delete_case1(node_type* node) {
-				if (node->parent->value != NULL)
-					delete_case2(node);
+			void delete_case1(base_ptr node, base_ptr parent) {
+				if (parent != header())
+					delete_case2(node, parent);
 			}
 
 			// node(치환한 자식 노드)의 형제 노드가 red인 case
@@ -586,17 +1564,17 @@ namespace ft {
 			// black인 자식 노드와 red인 부모 노드를 가지고 있으므로 delete_case4,5,6(case2,3,4)을 진행한다.
 			// 새로운 형제 노드는 red였던 형제 노드(조상 노드)의 자식 노드였으므로 black이다.
 			// (red의 자식은 black이라는 속성)
-			void delete_case2(node_type* node) {
-				node_type* sibling = get_sibling(node);
-				if (sibling->color == RED) {
-					node->parent->color = RED;
-					sibling->color = BLACK;
-					if (node == node->parent->leftChild)
-						rotate_left(node->parent);
+			void delete_case2(base_ptr node, base_ptr parent) {
+				base_ptr sibling = get_sibling(node, parent);
+				if (sibling->get_color() == RED) {
+					parent->set_color(RED);
+					sibling->set_color(BLACK);
+					if (node == parent->leftChild)
+						rotate_left(parent);
 					else
-						rotate_right(node->parent);
+						rotate_right(parent);
 				}
-				delete_case3(node);
+				delete_case3(node, parent);
 			}
 
 			// delete_case2를 통과하면 자식 노드와 형제 노드는 반드시 black이 된다.
@@ -621,14 +1599,14 @@ namespace ft {
 			// -> 이는 삭제할 노드를 삭제하는 과정에서 그 자식 노드가 지나는 모든 경로가 하나 줄어들게 되므로 양쪽은 같은 수의 black node경로를 가지게 된다.
 			// -> 그러나 부모 노드를 지나는 모든 경로는 부모 노드를 지나지 않는 모든 경로에 대해 black노드를 하나 덜 가지게 되어 5번 속성을 위반하게 된다.
 			// -> 이를 해결하기위해 delete_case1부터 시작하는 rebalancing 과정을 수행해야 한다.
-			void delete_case3(node_type* node) {
-				node_type* sibling = get_sibling(node);
-				if (node->parent->color == BLACK && sibling->color == BLACK && sibling->leftChild->color == BLACK && sibling->rightChild->color == BLACK) {
-					sibling->color = RED;
-					delete_case1(node->parent);
+			void delete_case3(base_ptr node, base_ptr parent) {
+				base_ptr sibling = get_sibling(node, parent);
+				if (parent->get_color() == BLACK && sibling->get_color() == BLACK && sibling->leftChild->get_color() == BLACK && sibling->rightChild->get_color() == BLACK) {
+					sibling->set_color(RED);
+					delete_case1(parent, parent->get_parent());
 				}
 				else
-					delete_case4(node);
+					delete_case4(node, parent);
 			}
 
 
@@ -641,14 +1619,14 @@ namespace ft {
 			// -> 부모 노드와 형제 노드의 색을 바꿔주면 된다.
 			// -> 형제 노드를 지나는 경로의 black수는 영향을 주지않지만,
 			// -> 자식 노드를 지나는 경로에 대해서 black수를 1증가 시칸다.
-			void delete_case4(node_type* node) {
-				node_type* sibling = get_sibling(node);
-				if (node->parent->color == RED && sibling->color == BLACK && sibling->leftChild->color == BLACK && sibling->rightChild->color == BLACK) {
-					sibling->color = RED;
-					node->parent->color = BLACK;
+			void delete_case4(base_ptr node, base_ptr parent) {
+				base_ptr sibling = get_sibling(node, parent);
+				if (parent->get_color() == RED && sibling->get_color() == BLACK && sibling->leftChild->get_color() == BLACK && sibling->rightChild->get_color() == BLACK) {
+					sibling->set_color(RED);
+					parent->set_color(BLACK);
 				}
 				else
-					delete_case5(node);
+					delete_case5(node, parent);
 			}
 
 			// delete_case5 -> 위의 설명한 case3
@@ -660,22 +1638,22 @@ namespace ft {
 			// -> 형제 노드를 오른쪽 회전 후 형제 노드의 왼쪽 자식을 형제 노드 자신의 부모 노드이자, 새로운 형제 노드로 만든다.
 			// -> 기존 형제 노드의 색을 부모 노드(기존의 형제 노드의 왼쪽 자식)의 색과 바꾼다.
 			// -> delete_case6를 적용하여 해결
-			void delete_case5(node_type* node) {
-				node_type* sibling = get_sibling(node);
+			void delete_case5(base_ptr node, base_ptr parent) {
+				base_ptr sibling = get_sibling(node, parent);
 
-				if (sibling->color == BLACK) {
-					if (node == node->parent->leftChild && sibling->rightChild->color == BLACK && sibling->leftChild->color == RED) {
-						sibling->color = RED;
-						sibling->leftChild->color = BLACK;
+				if (sibling->get_color() == BLACK) {
+					if (node == parent->leftChild && sibling->rightChild->get_color() == BLACK && sibling->leftChild->get_color() == RED) {
+						sibling->set_color(RED);
+						sibling->leftChild->set_color(BLACK);
 						rotate_right(sibling);
 					}
-					else if (node == node->parent->rightChild && sibling->leftChild->color == BLACK && sibling->rightChild->color == RED) {
-						sibling->color = RED;
-						sibling->rightChild->color = BLACK;
+					else if (node == parent->rightChild && sibling->leftChild->get_color() == BLACK && sibling->rightChild->get_color() == RED) {
+						sibling->set_color(RED);
+						sibling->rightChild->set_color(BLACK);
 						rotate_left(sibling);
 					}
 				}
-				delete_case6(node);
+				delete_case6(node, parent);
 			}
 
 			// delete_case6 -> 위의 설명한 case4
@@ -690,20 +1668,206 @@ namespace ft {
 
 			// 결과론적인 방법
 			// (오른쪽) 형제는 부모의 색으로, (오른쪽) 형제의 (오른쪽) 자녀는 black으로 부모는 black으로 바꾼 후에 부모를 기준으로 (왼쪽)으로 회전하여 해결
-			void delete_case6(node_type* node) {
-				node_type* sibling = get_sibling(node);
-				sibling->color = node->parent->color;
-				node->parent->color = BLACK;
-				if (node == node->parent->leftChild) {
-					sibling->rightChild->color = BLACK;
-					rotate_left(node->parent);
+			void delete_case6(base_ptr node, base_ptr parent) {
+				base_ptr sibling = get_sibling(node, parent);
+				sibling->set_color(parent->get_color());
+				parent->set_color(BLACK);
+				if (node == parent->leftChild) {
+					sibling->rightChild->set_color(BLACK);
+					rotate_left(parent);
 				}
 				else {
-					sibling->leftChild->color = BLACK;
-					rotate_right(node->parent);
+					sibling->leftChild->set_color(BLACK);
+					rotate_right(parent);
+				}
+			}
+
+
+			//split / join
+			//from의 노드를 이 tree로 옮겨도 되는지 확인한다.
+			//slab에서 받은 노드는 slab과 같이 해제해야 하고, 노드는 같은 allocator로 해제해야 한다.
+			bool can_adopt(const RBTree& from) const {
+				return (!from.has_slabs() && get_node_alloc() == from.get_node_alloc());
+			}
+
+			//new_root를 root로 하는 서브트리로 header를 다시 연결한다.
+			void reset_root(base_ptr new_root) {
+				if (new_root == nil())
+					set_header(nil(), NULL, NULL);
+				else
+					set_header(new_root, get_min_node(new_root), get_max_node(new_root));
+			}
+
+			//node부터 nil까지의 경로에 있는 BLACK 노드의 수 (node 포함, 어느 경로로 내려가도 같다)
+			size_type get_black_height(base_ptr node) const {
+				size_type res = 0;
+				for (; node != nil(); node = node->leftChild) {
+					if (node->get_color() == BLACK)
+						res++;
 				}
+				return (res);
 			}
 
+			//a의 key가 b의 key보다 앞에 와도 되는지 (unique이면 같은 key는 안 된다)
+			bool is_before(base_ptr a, base_ptr b, bool unique) const {
+				if (unique)
+					return (get_comp()(get_key(a), get_key(b)));
+				return (!get_comp()(get_key(b), get_key(a)));
+			}
+
+			//split 후 이 tree의 노드 개수를 구한다. (total - 두 tree의 노드 수의 합)
+			//서브트리 크기가 있으면 root의 크기를 읽는다.
+			size_type count_split(const RBTree&, size_type, ft::true_type) const {
+				return (get_subtree_size(root()));
+			}
+
+			//없으면 두 tree를 앞에서부터 한 칸씩 같이 훑어 먼저 끝나는 쪽을 센다. -> 작은 쪽의 개수만큼 든다.
+			size_type count_split(const RBTree& right, size_type total, ft::false_type) const {
+				size_type n = 0;
+				base_ptr a = this->_leftmost;
+				base_ptr b = right._leftmost;
+				while (a != header() && b != right.header()) {
+					a = get_next_node(a);
+					b = right.get_next_node(b);
+					n++;
+				}
+				return (a == header() ? n : total - n);
+			}
+
+			//노드를 옮길 수 없으면 other의 값을 하나씩 복사해 넣고 other에서 지운다.
+			//other는 정렬되어 있으므로 end를 hint로 주면 이 tree 뒤에 이어지는 경우 노드마다 O(1)이다.
+			void join_by_copy(RBTree& other, bool unique) {
+				base_ptr node = other._leftmost;
+				while (node != other.header()) {
+					base_ptr next = other.get_next_node(node);
+					if (!unique)
+						insert_equal(get_value(node), header());
+					else if (!insert(get_value(node), header()).second) {
+						node = next;
+						continue ;
+					}
+					other.erase(node);
+					node = next;
+				}
+			}
+
+			//node를 root로 하는 서브트리(black height가 height)를 key가 k보다 작은 서브트리와 k 이상인 서브트리로 나눈다.
+			//경로 밖의 서브트리는 그대로 떼어 쓰고, 경로 위의 노드는 pivot으로 다시 붙인다.
+			//자식의 black height는 node가 BLACK이면 하나 작다. (RED인 자식은 join_tree가 BLACK으로 바꾼다)
+			void split_node(base_ptr node, size_type height, const key_type& k,
+				base_ptr& left, size_type& left_height, base_ptr& right, size_type& right_height) {
+				if (node == nil()) {
+					left = nil();
+					right = nil();
+					left_height = 0;
+					right_height = 0;
+					return ;
+				}
+				base_ptr left_child = node->leftChild;
+				base_ptr right_child = node->rightChild;
+				size_type child_height = height - (node->get_color() == BLACK);
+				if (get_comp()(get_key(node), k)) {
+					//node와 왼쪽 서브트리는 모두 left로 간다.
+					base_ptr rest;
+					size_type rest_height;
+					split_node(right_child, child_height, k, rest, rest_height, right, right_height);
+					left = join_tree(left_child, child_height, node, rest, rest_height, left_height);
+				}
+				else {
+					base_ptr rest;
+					size_type rest_height;
+					split_node(left_child, child_height, k, left, left_height, rest, rest_height);
+					right = join_tree(rest, rest_height, node, right_child, child_height, right_height);
+				}
+			}
+
+			/**
+			 * join_tree
+			 * left(모든 key < pivot) + pivot + right(모든 key > pivot)를 하나의 red-black tree로 만들어 root를 반환한다.
+			 * left_height, right_height - 두 서브트리의 black height, 만든 tree의 black height를 height에 기록한다.
+			 * 1) 높이가 같으면 pivot을 BLACK root로 두고 양쪽을 자식으로 붙인다.
+			 * 2) left가 더 높으면 left의 오른쪽 끝 경로를 따라 black height가 right와 같은 BLACK 노드 c까지 내려가
+			 *    그 자리에 RED pivot을 두고 c와 right를 자식으로 붙인다. -> 모든 경로의 black 수가 그대로다.
+			 *    pivot의 부모가 RED이면 삽입과 같은 방법(insert_case4, 5)으로 고친다.
+			 * 3) right가 더 높으면 왼쪽 끝 경로로 같은 방법을 쓴다.
+			 * 내려가는 깊이와 고치는 범위는 모두 높이 차이에 비례한다. -> O(|left_height - right_height| + 1)
+			 * 2), 3)은 높은 쪽을 이 tree의 header에 잠시 연결해 root를 찾는다.
+			 */
+			base_ptr join_tree(base_ptr left, size_type left_height, base_ptr pivot, base_ptr right, size_type right_height, size_type& height) {
+				//root가 RED이면 BLACK으로 바꾼다. (nil은 BLACK이므로 쓰지 않는다)
+				if (left->get_color() == RED) {
+					left->set_color(BLACK);
+					left_height++;
+				}
+				if (right->get_color() == RED) {
+					right->set_color(BLACK);
+					right_height++;
+				}
+				if (left_height == right_height) {
+					pivot->set_color(BLACK);
+					link_children(pivot, left, right);
+					update_node(pivot);
+					height = left_height + 1;
+					return (pivot);
+				}
+				bool left_higher = (left_height > right_height);
+				base_ptr node = left_higher ? left : right;
+				size_type node_height = left_higher ? left_height : right_height;
+				size_type target_height = left_higher ? right_height : left_height;
+				header()->leftChild = node;
+				node->set_parent(header());
+				base_ptr parent;
+				do {
+					node_height -= (node->get_color() == BLACK);
+					parent = node;
+					node = left_higher ? node->rightChild : node->leftChild;
+				} while (node->get_color() == RED || node_height > target_height);
+				pivot->set_color(RED);
+				pivot->set_parent(parent);
+				if (left_higher) {
+					parent->rightChild = pivot;
+					link_children(pivot, node, right);
+				}
+				else {
+					parent->leftChild = pivot;
+					link_children(pivot, left, node);
+				}
+				update_node(pivot);
+				recompute_path(parent);
+				height = (left_higher ? left_height : right_height) + fix_join(pivot);
+				return (root());
+			}
+
+			//pivot의 자식으로 left, right를 연결한다. (nil에는 parent를 쓰지 않는다)
+			void link_children(base_ptr pivot, base_ptr left, base_ptr right) {
+				pivot->leftChild = left;
+				pivot->rightChild = right;
+				if (left != nil())
+					left->set_parent(pivot);
+				if (right != nil())
+					right->set_parent(pivot);
+			}
+
+			//join_tree로 붙인 RED 노드의 부모도 RED이면 insert_case3 ~ 5와 같이 고친다.
+			//insert_case1과 달리 root가 RED가 되면 여기서 BLACK으로 바꾸고 true를 반환한다. (black height가 1 늘어난다)
+			bool fix_join(base_ptr node) {
+				while (node->get_parent() != header() && node->get_parent()->get_color() == RED) {
+					base_ptr uncle = get_uncle(node);
+					if (uncle == nil() || uncle->get_color() == BLACK) {
+						insert_case4(node);
+						return (false);
+					}
+					node->get_parent()->set_color(BLACK);
+					uncle->set_color(BLACK);
+					node = get_grandparent(node);
+					node->set_color(RED);
+				}
+				if (node->get_parent() == header() && node->get_color() == RED) {
+					node->set_color(BLACK);
+					return (true);
+				}
+				return (false);
+			}
 
 			template <typename _T>
 			void swap(_T& a, _T& b) {
@@ -0,0 +1,125 @@
+#ifndef RB_TREE_AUGMENT_HPP
+# define RB_TREE_AUGMENT_HPP
+
+#include <cstddef>
+#include "utils.hpp"
+#include "RB_Tree_node.hpp"
+
+namespace ft {
+	/*
+	 * augmentation 정책
+		RBTree의 노드마다 서브트리 전체에서 모은 값(data)을 더 저장하고, 삽입 / 삭제 / 회전 때 갱신한다.
+		data는 자신의 value와 두 자식의 data만으로 계산해야 한다. -> 회전할 때는 두 노드만 다시 계산하면 된다.
+		- enabled	- false_type이면 노드에 아무것도 더하지 않는다. (노드 크기, 갱신 비용 모두 없다)
+		- data_type	- 노드마다 저장할 값. 서브트리의 노드 개수인 size 멤버를 가진다.
+		- update(data, value, left, right)	- 자식의 data(nil이면 NULL)와 value로 data를 다시 계산한다.
+		- size_only	- data가 size뿐이면 true_type. 삽입 / 삭제 때 root까지의 경로에서 형제 노드를 읽지 않고 개수만 바꾼다.
+		- result_type, identity(), lift(value), combine(a, b), get_result(data)
+			구간의 값을 모으는 monoid. RBTree::aggregate가 중위 순회 순서대로 합친다.
+	*/
+	struct rb_no_augment {
+		typedef false_type	enabled;
+		typedef void	result_type;
+
+		struct data_type {};
+	};
+
+	// 서브트리의 노드 개수만 저장한다. -> nth, rank, 두 iterator 사이의 거리를 O(log n)에 구한다.
+	// aggregate는 구간 안의 노드 개수가 된다.
+	struct rb_size_augment {
+		typedef true_type	enabled;
+		typedef true_type	size_only;
+		typedef std::size_t	result_type;
+
+		struct data_type {
+			std::size_t	size;
+		};
+
+		template <typename T>
+		static void update(data_type& data, const T&, const data_type* left, const data_type* right) {
+			data.size = 1 + (left ? left->size : 0) + (right ? right->size : 0);
+		}
+
+		static result_type identity() { return (0); }
+		template <typename T>
+		static result_type lift(const T&) { return (1); }
+		static result_type combine(result_type a, result_type b) { return (a + b); }
+		static result_type get_result(const data_type& data) { return (data.size); }
+	};
+
+	/*
+	 * rb_monoid_augment
+		사용자가 정의한 monoid로 서브트리의 값을 모은다. 서브트리의 노드 개수도 같이 저장한다.
+		Monoid - 결합법칙을 만족하는 연산 (교환법칙은 필요 없다), 상태 없이 기본 생성할 수 있어야 한다.
+			삽입 / 삭제 / 회전 도중에 불리므로 lift, combine은 예외를 던지지 않아야 한다.
+			typedef ... result_type;
+			result_type identity() const;	// 항등원
+			result_type lift(const value_type&) const;	// 노드 하나의 값
+			result_type combine(const result_type&, const result_type&) const;
+		ex) mapped 값의 구간 합
+			ft::map<int, long, ft::less<int>, std::allocator<ft::pair<const int, long> >,
+				ft::rb_monoid_augment< ft::sum_monoid< long, ft::select2nd< ft::pair<const int, long> > > > >
+	*/
+	template <typename Monoid>
+	struct rb_monoid_augment {
+		typedef true_type	enabled;
+		typedef false_type	size_only;
+		typedef typename Monoid::result_type	result_type;
+
+		struct data_type {
+			std::size_t	size;
+			result_type	sum;
+		};
+
+		template <typename T>
+		static void update(data_type& data, const T& value, const data_type* left, const data_type* right) {
+			data.size = 1;
+			data.sum = Monoid().lift(value);
+			if (left) {
+				data.size += left->size;
+				data.sum = Monoid().combine(left->sum, data.sum);
+			}
+			if (right) {
+				data.size += right->size;
+				data.sum = Monoid().combine(data.sum, right->sum);
+			}
+		}
+
+		static result_type identity() { return (Monoid().identity()); }
+		template <typename T>
+		static result_type lift(const T& value) { return (Monoid().lift(value)); }
+		static result_type combine(const result_type& a, const result_type& b) { return (Monoid().combine(a, b)); }
+		static const result_type& get_result(const data_type& data) { return (data.sum); }
+	};
+
+	// value에서 Extract로 꺼낸 값을 operator+로 더하는 monoid
+	template <typename Result, typename Extract>
+	struct sum_monoid {
+		typedef Result	result_type;
+
+		result_type identity() const { return (Result()); }
+		template <typename T>
+		result_type lift(const T& value) const { return (Extract()(value)); }
+		result_type combine(const result_type& a, const result_type& b) const { return (a + b); }
+	};
+
+	// data를 value 뒤에 둔다.
+	// -> RBTreeNode<T>로 static_cast해도 value의 위치가 같으므로 iterator는 augmentation을 몰라도 된다.
+	template <typename T, typename Data>
+	struct RBTreeAugNode : public RBTreeNode<T> {
+		Data	data;
+	};
+
+	// augmentation이 없으면 노드는 RBTreeNode<T> 그대로이다.
+	template <typename T, typename Augment, bool = Augment::enabled::value>
+	struct rb_augment_node {
+		typedef RBTreeNode<T>	type;
+	};
+
+	template <typename T, typename Augment>
+	struct rb_augment_node<T, Augment, true> {
+		typedef RBTreeAugNode<T, typename Augment::data_type>	type;
+	};
+} // namespace ft
+
+#endif
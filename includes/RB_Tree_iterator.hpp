@@ -14,51 +14,52 @@ namespace ft {
 			typedef typename ft::iterator<ft::bidirectional_iterator_tag, T>::difference_type	difference_type;
 			typedef typename ft::iterator<ft::bidirectional_iterator_tag, T>::iterator_category	iterator_category;
 			typedef ft::RBTreeNode<T> node_type;
+			typedef ft::RBTreeNodeBase::base_ptr base_ptr;
 		protected :
-			node_type* _node;
+			base_ptr _node;
 
 		public:
 			// Construct a new RBTreeIterator object
 			// Default constructor
-			RBTreeIterator(node_type* ptr = NULL) : _node(ptr) {}
-			// Copy constructor
-			RBTreeIterator(const RBTreeIterator<T>& copy) : _node(copy.base()) {}
-			// Assignment operator
-			RBTreeIterator& operator=(const RBTreeIterator& copy) {
-				if (this != &copy)
-					this->_node = copy.base();
-				return (*this);
-			}
+			RBTreeIterator(base_ptr ptr = NULL) : _node(ptr) {}
+			// Copy constructor / Assignment operator
+			// 암시적으로 만들어지는 복사 생성자와 대입 연산자를 쓴다.
+			// (둘 중 하나만 직접 선언하면 c++11 이상에서 deprecated-copy 경고가 난다)
+			// iterator -> const_iterator 변환은 템플릿 생성자로 한다. (const_iterator -> iterator는 U를 추론할 수 없어 막힌다)
+			template <typename U>
+			RBTreeIterator(const RBTreeIterator<U, U*, U&>& copy) : _node(copy.base()) {}
 			// Destructor
 			virtual ~RBTreeIterator() {}
 			// Getter
-			node_type* const &base() const {
+			base_ptr const &base() const {
 				return (this->_node);
 			}
 
 			// Operators
 			reference operator*() const {
-				return (*this->_node->value);
+				return (static_cast<node_type*>(this->_node)->value);
 			}
 			pointer operator->() const {
-				return (this->_node->value);
+				return (&static_cast<node_type*>(this->_node)->value);
 			}
+			// nil은 모든 tree가 공유하는 노드이므로 주소만 비교한다. -> 자식 노드를 읽지 않는다.
 			RBTreeIterator& operator++() {
-				node_type* tmp = NULL;
+				base_ptr tmp = NULL;
 				// if rightChild exists,
-				if (_node->rightChild->value != NULL) {
+				if (_node->rightChild != RBTreeNodeBase::nil()) {
 					tmp = _node->rightChild;
 					// search the leftmost of the rightChild.
-					while (tmp->leftChild->value != NULL)
+					while (tmp->leftChild != RBTreeNodeBase::nil())
 						tmp = tmp->leftChild;
 				}
 				else {	// if rightChild doesn't exist,
-					tmp = _node->parent;
+					// root의 부모는 header이고, header의 rightChild는 자기 자신이므로 header에서 멈춘다.
+					tmp = _node->get_parent();
 					if (tmp->rightChild == _node)
 					{	// if current node is rightChild,
-						while (tmp->parent->rightChild == tmp)
-							tmp = tmp->parent;
-						tmp = tmp->parent;
+						while (tmp->get_parent()->rightChild == tmp)
+							tmp = tmp->get_parent();
+						tmp = tmp->get_parent();
 					}
 				}
 				_node = tmp;
@@ -70,23 +71,24 @@ namespace ft {
 				return (tmp);
 			}
 			RBTreeIterator& operator--() {
-				node_type* tmp = NULL;
-				if (_node->value == NULL)
-					tmp = _node->parent;
+				base_ptr tmp = NULL;
+				// end(header)의 parent는 가장 오른쪽 노드이다.
+				if (_node->is_header())
+					tmp = _node->get_parent();
 				// if leftChild exists,
-				else if (_node->leftChild->value != NULL) {
+				else if (_node->leftChild != RBTreeNodeBase::nil()) {
 					tmp = _node->leftChild;
 					// search the rightmost of the leftChild.
-					while (tmp->rightChild->value != NULL)
+					while (tmp->rightChild != RBTreeNodeBase::nil())
 						tmp = tmp->rightChild;
 				}
 				else {	// if leftChild doesn't exist,
-					tmp = _node->parent;
+					tmp = _node->get_parent();
 					// if current node is leftChild,
 					if (tmp->leftChild == _node) {
-						while (tmp->parent->leftChild == tmp)
-							tmp = tmp->parent;
-						tmp = tmp->parent;
+						while (tmp->get_parent()->leftChild == tmp)
+							tmp = tmp->get_parent();
+						tmp = tmp->get_parent();
 					}
 				}
 				_node = tmp;
@@ -1,58 +1,88 @@
 #ifndef RB_TREE_NODE_HPP
 # define RB_TREE_NODE_HPP
 
+#include <cstddef>
 #include <memory>
 
 namespace ft {
-	enum RBColor { RED = false, BLACK = true };
+	// 색은 parent 포인터의 가장 낮은 bit에 넣는다. (0 - BLACK, 1 - RED)
+	// 0으로 초기화된 노드(정적 nil 노드)는 BLACK이 된다.
+	enum RBColor { BLACK = 0, RED = 1 };
 
-	template < typename T, typename Alloc = std::allocator<T> >
-	struct RBTreeNode {
+	// 색과 링크만 가지는 노드
+	// 노드는 포인터를 담고 있어 항상 2 이상으로 정렬되므로 parent의 최하위 bit는 비어있다.
+	// -> 색을 위한 필드 없이 포인터 3개 크기가 된다.
+	struct RBTreeNodeBase {
 	public :
-		typedef T	value_type;
-		typedef RBTreeNode*	node;
+		typedef RBTreeNodeBase*	base_ptr;
+		typedef const RBTreeNodeBase*	const_base_ptr;
+
+	private :
+		std::size_t	_parent_color;	// parent 포인터 | 색
 
-		value_type*	value;
-		node	parent;
-		node	leftChild;
-		node	rightChild;
-		RBColor	color;
-		Alloc	alloc;
+	public :
+		base_ptr	leftChild;
+		base_ptr	rightChild;
 
 		//default
-		RBTreeNode() : value(NULL), parent(NULL), leftChild(NULL), rightChild(NULL), color(BLACK), alloc(Alloc()) {}
+		RBTreeNodeBase() : _parent_color(0), leftChild(NULL), rightChild(NULL) {}
+
+		base_ptr get_parent() const {
+			return (reinterpret_cast<base_ptr>(_parent_color & ~static_cast<std::size_t>(1)));
+		}
 
-		//initialization
-		RBTreeNode(const T& val) : value(NULL), parent(NULL), leftChild(NULL), rightChild(NULL), color(RED), alloc(Alloc()) {
-			value = alloc.allocate(1);
-			alloc.construct(value, val);
+		//색은 그대로 두고 parent만 바꾼다.
+		void set_parent(base_ptr parent) {
+			_parent_color = reinterpret_cast<std::size_t>(parent) | (_parent_color & 1);
 		}
 
-		//copy
-		RBTreeNode(const RBTreeNode& copy) : value(NULL), parent(NULL), leftChild(NULL), rightChild(NULL), color(RED), alloc(Alloc()) {
-			if (copy.value != NULL) {
-				value = alloc.allocate(1);
-				alloc.construct(value, *copy.value);
-				color = copy.color;
-			}
+		RBColor get_color() const {
+			return (static_cast<RBColor>(_parent_color & 1));
 		}
 
-		//destruct
-		~RBTreeNode() {
-			if (value != NULL) {
-				alloc.destroy(value);
-				alloc.deallocate(value, 1);
-			}
+		void set_color(RBColor color) {
+			_parent_color = (_parent_color & ~static_cast<std::size_t>(1)) | color;
 		}
 
-		bool operator==(const RBTreeNode& node) const {
-			return (*this->value == *node->value);
+		//모든 tree가 공유하는 nil 노드 (leaf)
+		//주소 비교만으로 판단하므로 노드를 읽지 않는다.
+		static base_ptr nil();
+
+		bool is_nil() const {
+			return (this == nil());
 		}
 
-		bool operator!=(const RBTreeNode& node) const {
-			return (*this->value != *node->value);
+		//tree마다 하나씩 있는 header 노드 (end)
+		//header만 오른쪽 자식으로 자기 자신을 가리킨다.
+		bool is_header() const {
+			return (this->rightChild == this);
 		}
 	};
+
+	// nil 노드는 값이 없으므로 RBTreeNodeBase로만 만든다.
+	// 헤더만으로 쓸 수 있도록 클래스 템플릿의 정적 멤버로 정의한다.
+	// 어떤 tree도 nil에 쓰지 않으므로 여러 tree(스레드)가 같이 써도 된다.
+	template < typename Dummy >
+	struct RBTreeNil {
+		static RBTreeNodeBase node;
+	};
+
+	template < typename Dummy >
+	RBTreeNodeBase RBTreeNil<Dummy>::node;
+
+	inline RBTreeNodeBase::base_ptr RBTreeNodeBase::nil() {
+		return (&RBTreeNil<void>::node);
+	}
+
+	// 값을 노드 안에 직접 저장한다. -> 노드 하나당 할당 1번
+	// RBTree는 allocate로 메모리만 받은 뒤 value만 직접 construct 하므로 생성자를 두지 않는다.
+	template < typename T >
+	struct RBTreeNode : public RBTreeNodeBase {
+	public :
+		typedef T	value_type;
+
+		value_type	value;
+	};
 } // namespace ft
 
 #endif
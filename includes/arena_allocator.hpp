@@ -0,0 +1,201 @@
+#ifndef ARENA_ALLOCATOR_HPP
+# define ARENA_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#if __cplusplus >= 201103L
+# include <utility>
+#endif
+
+namespace ft {
+	// T를 저장할 때 필요한 정렬 크기 (c++98에는 alignof가 없다)
+	template < typename T >
+	struct alignment_of {
+		struct helper { char c; T t; };
+		static const std::size_t value = sizeof(helper) - sizeof(T);
+	};
+
+	/*
+	 * arena
+		큰 블록을 할당받아 앞에서부터 잘라 주기만 하는(bump-pointer) 메모리 공간.
+		개별 해제는 하지 않고, release() 또는 arena가 소멸될 때 모든 블록을 한 번에 해제한다.
+		scope를 만들면 그 사이에 할당한 메모리만 scope가 끝날 때 되돌린다.
+		-> 요청 하나 동안 쓰는 임시 map / vector를 노드마다 해제하지 않고 한 번에 버린다.
+		arena에서 할당받은 컨테이너는 arena보다 먼저(또는 같은 scope 안에서) 소멸되어야 한다.
+	*/
+	class arena {
+		private:
+			// 블록 앞에 붙는 header, 블록끼리 최근 것부터 연결한다.
+			struct block {
+				block*	next;
+			};
+
+			block*	_blocks;
+			char*	_cur;	// 현재 블록에서 다음에 줄 위치
+			char*	_end;	// 현재 블록의 끝
+			std::size_t	_block_size;
+
+			// 복사하면 같은 블록을 두 번 해제하게 되므로 막는다.
+			arena(const arena&);
+			arena& operator=(const arena&);
+
+		public:
+			explicit arena(std::size_t block_size = 64 * 1024)
+				: _blocks(NULL), _cur(NULL), _end(NULL), _block_size(block_size) {}
+
+			~arena() {
+				release();
+			}
+
+			// size 바이트를 align 에 맞춰 잘라 준다. 현재 블록에 자리가 없으면 새 블록을 붙인다.
+			// 블록의 끝은 8 byte 단위로만 맞춰져 있으므로 정렬한 위치가 블록 끝을 넘을 수 있다. -> 먼저 확인한다.
+			void* allocate(std::size_t size, std::size_t align) {
+				char* res = align_up(_cur, align);
+				if (_cur == NULL || res > _end || size > static_cast<std::size_t>(_end - res)) {
+					add_block(size + align);
+					res = align_up(_cur, align);
+				}
+				_cur = res + size;
+				return (res);
+			}
+
+			// 모든 블록을 해제한다.
+			void release() {
+				rewind(NULL, NULL, NULL);
+			}
+
+			// 지금까지 할당한 블록 수 (테스트 / 벤치마크 용)
+			std::size_t block_count() const {
+				std::size_t res = 0;
+				for (block* b = _blocks; b != NULL; b = b->next)
+					res++;
+				return (res);
+			}
+
+			// 만들어진 시점의 위치를 기억했다가 소멸될 때 그 위치로 되돌린다.
+			class scope {
+				private:
+					arena&	_arena;
+					block*	_blocks;
+					char*	_cur;
+					char*	_end;
+
+					scope(const scope&);
+					scope& operator=(const scope&);
+
+				public:
+					explicit scope(arena& a) : _arena(a), _blocks(a._blocks), _cur(a._cur), _end(a._end) {}
+					~scope() {
+						_arena.rewind(_blocks, _cur, _end);
+					}
+			};
+
+		private:
+			static char* align_up(char* ptr, std::size_t align) {
+				std::size_t mod = reinterpret_cast<std::size_t>(ptr) % align;
+				return (mod == 0 ? ptr : ptr + (align - mod));
+			}
+
+			// 블록 크기보다 큰 요청은 그 크기만큼의 블록을 따로 만든다.
+			void add_block(std::size_t size) {
+				std::size_t block_size = sizeof(block) + (size > _block_size ? size : _block_size);
+				block* b = static_cast<block*>(::operator new(block_size));
+				b->next = _blocks;
+				_blocks = b;
+				_cur = reinterpret_cast<char*>(b + 1);
+				_end = reinterpret_cast<char*>(b) + block_size;
+			}
+
+			// blocks 이후에 붙은 블록을 해제하고 현재 위치를 되돌린다.
+			void rewind(block* blocks, char* cur, char* end) {
+				while (_blocks != blocks) {
+					block* next = _blocks->next;
+					::operator delete(_blocks);
+					_blocks = next;
+				}
+				_cur = cur;
+				_end = end;
+			}
+	}; // class arena
+
+	/*
+	 * arena_allocator
+		arena에서 메모리를 받는 allocator. 모든 ft 컨테이너의 Alloc 인자로 쓸 수 있다.
+		rebind된 allocator(RBTree의 노드 allocator 등)도 같은 arena를 가리킨다.
+		deallocate는 아무것도 하지 않으며, 메모리는 arena를 release 할 때 한 번에 돌아간다.
+		ex) ft::arena a;
+			ft::map<int, int, ft::less<int>, ft::arena_allocator<ft::pair<const int, int> > > m(ft::less<int>(), a);
+	*/
+	template < typename T >
+	class arena_allocator {
+		public:
+			typedef T	value_type;
+			typedef T*	pointer;
+			typedef const T*	const_pointer;
+			typedef T&	reference;
+			typedef const T&	const_reference;
+			typedef std::size_t	size_type;
+			typedef std::ptrdiff_t	difference_type;
+
+			template < typename U >
+			struct rebind {
+				typedef arena_allocator<U>	other;
+			};
+
+		private:
+			arena*	_arena;
+
+		public:
+			// arena 없이 만들 수 없다. (기본 생성자 없음)
+			arena_allocator(arena& a) : _arena(&a) {}
+			template < typename U >
+			arena_allocator(const arena_allocator<U>& other) : _arena(other.get_arena()) {}
+
+			arena* get_arena() const { return (_arena); }
+
+			pointer address(reference x) const { return (&x); }
+			const_pointer address(const_reference x) const { return (&x); }
+
+			pointer allocate(size_type n, const void* = NULL) {
+				if (n > max_size())
+					throw (std::bad_alloc());
+				return (static_cast<pointer>(_arena->allocate(n * sizeof(T), ft::alignment_of<T>::value)));
+			}
+
+			// 개별 해제는 하지 않는다.
+			void deallocate(pointer, size_type) {}
+
+			size_type max_size() const {
+				return (std::numeric_limits<size_type>::max() / sizeof(T));
+			}
+
+#if __cplusplus >= 201103L
+			template < typename U, typename... Args >
+			void construct(U* p, Args&&... args) {
+				::new(static_cast<void*>(p)) U(std::forward<Args>(args)...);
+			}
+#else
+			void construct(pointer p, const_reference val) {
+				::new(static_cast<void*>(p)) T(val);
+			}
+#endif
+
+			void destroy(pointer p) {
+				p->~T();
+			}
+	}; // class arena_allocator
+
+	// 같은 arena를 쓰면 한쪽에서 할당한 메모리를 다른 쪽에서 해제해도 된다.
+	template < typename T, typename U >
+	bool operator==(const arena_allocator<T>& lhs, const arena_allocator<U>& rhs) {
+		return (lhs.get_arena() == rhs.get_arena());
+	}
+
+	template < typename T, typename U >
+	bool operator!=(const arena_allocator<T>& lhs, const arena_allocator<U>& rhs) {
+		return (!(lhs == rhs));
+	}
+} // namespace ft
+
+#endif
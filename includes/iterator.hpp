@@ -2,6 +2,7 @@
 #define ITERATOR_TRAITS_HPP
 
 #include <cstddef> // ptrdiff_t 사용 : 두 포인터를 뺀 결과의 부호 있는 정수 유형
+#include <iterator> // std 반복자의 category tag
 
 namespace ft {
 
@@ -43,6 +44,55 @@ namespace ft {
 		typedef random_access_iterator_tag iterator_category;
 	};
 
+	// std 반복자(std::list 등)의 category tag를 ft tag로 바꿔준다.
+	// ft tag와 std tag는 서로 상속 관계가 없으므로 tag dispatch 전에 맞춰줘야 한다.
+	template < class Category >
+	struct to_ft_category { typedef Category type; };
+
+	template <>
+	struct to_ft_category< std::input_iterator_tag > { typedef input_iterator_tag type; };
+
+	template <>
+	struct to_ft_category< std::output_iterator_tag > { typedef output_iterator_tag type; };
+
+	template <>
+	struct to_ft_category< std::forward_iterator_tag > { typedef forward_iterator_tag type; };
+
+	template <>
+	struct to_ft_category< std::bidirectional_iterator_tag > { typedef bidirectional_iterator_tag type; };
+
+	template <>
+	struct to_ft_category< std::random_access_iterator_tag > { typedef random_access_iterator_tag type; };
+
+	// 반복자의 category tag 객체를 반환한다. (tag dispatch 용)
+	template < class Iterator >
+	typename to_ft_category< typename iterator_traits< Iterator >::iterator_category >::type
+	iterator_category(const Iterator&) {
+		return (typename to_ft_category< typename iterator_traits< Iterator >::iterator_category >::type());
+	}
+
+	// 요소가 연속된 메모리에 있는 반복자인지 확인하고, 그 주소를 꺼낸다.
+	// memcmp 같은 메모리 단위 연산으로 알고리즘을 바꿀 때 사용한다.
+	template < class Iterator >
+	struct contiguous_iterator {
+		static const bool value = false;
+		typedef void value_type;
+	};
+
+	template < class T >
+	struct contiguous_iterator< T* > {
+		static const bool value = true;
+		typedef T value_type;
+		static const T* address(T* it) { return (it); }
+	};
+
+	template < class T >
+	struct contiguous_iterator< const T* > {
+		static const bool value = true;
+		typedef T value_type;
+		static const T* address(const T* it) { return (it); }
+	};
+
 	// iterator 클래스를 파생하는데 사용할 수 있는 기본 클래스 템플릿
 	// 해당 클래스는 iterator클래스가 아니며 iterator가 사용할 것으로 예상되는 기능을 제공하지 않는다.
 	// std::iterator는 반복자에 필요한 유형의 정의를 단순화하기 위해 제공되는 기본 클래스입니다.
@@ -7,7 +7,8 @@ namespace ft {
 	template < class Key,	// map::key_type
 			class T,	// map::mapped_type
 			class Compare = ft::less< Key >,	// map::key_compare
-			class Alloc = std::allocator< ft::pair< const Key, T > > >	// map::allocator_type
+			class Alloc = std::allocator< ft::pair< const Key, T > >,	// map::allocator_type
+			class Augment = ft::rb_no_augment >	// 노드마다 서브트리의 값을 모아 저장하는 정책 (RB_Tree_augment.hpp)
 	class map {
 		public:
 			// Member types
@@ -49,33 +50,31 @@ namespace ft {
 			typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
 			typedef typename allocator_type::difference_type difference_type;
 			typedef typename allocator_type::size_type size_type;
-			typedef ft::RBTree<value_type, value_compare> rb_tree;
-			typedef ft::RBTreeNode<value_type> node_type;
+			typedef ft::RBTree<key_type, value_type, ft::select1st<value_type>, key_compare, allocator_type, Augment> rb_tree;
+			typedef typename rb_tree::result_type aggregate_type;
+			typedef typename rb_tree::base_ptr base_ptr;
 
 		private:
-			allocator_type _alloc;
+			// 비교 객체와 allocator는 tree 안에 (비어있으면 크기 없이) 저장한다.
 			rb_tree _tree;
-			key_compare _comp;
 
 		public:
 			// Member function
 			// Construct map
 			// empty container constructor (default constructor)
-			explicit map (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _alloc(alloc), _tree(), _comp(comp) {}
+			explicit map (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _tree(comp, alloc) {}
 			// range constructor
 			template <class InputIterator>
 			map (InputIterator first, InputIterator last,
 					const key_compare& comp = key_compare(),
 					const allocator_type& alloc = allocator_type(),
-					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) : _alloc(alloc), _tree(), _comp(comp) {
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) : _tree(comp, alloc) {
 				insert(first, last);
 			}
 			// copy constructor
-			map(const map& x) : _alloc(x._alloc), _tree(), _comp(x._comp){
-				*this = x;
-			}
+			map(const map& x) : _tree(x._tree) {}
 			// Map destructor
- 			virtual ~map() {}
+			~map() {}
 			// Copy container content
 			map& operator=(const map& x) {
 				if (this != &x) {
@@ -83,6 +82,17 @@ namespace ft {
 				}
 				return (*this);
 			}
+#if __cplusplus >= 201103L
+			// move (c++11)
+			// tree의 노드를 그대로 가져오고 x는 빈 map이 된다.
+			map(map&& x) : _tree(std::move(x._tree)) {}
+			map& operator=(map&& x) {
+				if (this != &x) {
+					this->_tree = std::move(x._tree);
+				}
+				return (*this);
+			}
+#endif
 
 			// Iterators
 			iterator begin() { return (iterator(_tree.get_begin())); }
@@ -110,25 +120,80 @@ namespace ft {
 			size_type max_size() const {
 				return (this->_tree.max_size());
 			}
+			// 요소 n개를 담을 노드를 미리 한 번에 할당한다. (std::map에는 없는 확장)
+			// 지워진 노드는 map 안에서 재사용되므로, size()가 n을 넘지 않는 동안 insert/erase는 힙 할당을 하지 않는다.
+			// reserve한 노드는 clear() 후에도 남아 있고 map이 소멸될 때 해제된다.
+			void reserve(size_type n) {
+				this->_tree.reserve(n);
+			}
 
 			// Element access
 			// k가 컨테이너에 있는 요소의 키와 일치하면 매핑된 값에 대한 참조를 반환하는 함수
 			// k가 컨테이너에 있는 요소의 키와 일치하지 않으면 함수는 해당 키를 사용하여 새 요소를 삽입하고 매핑된 값에 대한 참조를 반환한다.
 			// 이렇게 하면 요소에 매핑되니 값이 할당되지 않더라도(기본 생성자를 사용하여 생성됨) 항상 컨테이너 크기가 1씩 증가한다.
 			// at과 비슷한 역할을 하지만 map::at은 키가 있는 요소가 존재할 때 같은 동작을 하지만 그렇지 않으면 에러를 발생시킨다. -> c++11에서 사용
+			// 한 번의 탐색으로 위치를 찾고, k가 없을 때만 mapped_type()을 만들어 삽입한다.
 			mapped_type& operator[](const key_type& k) {
-				return (*(_tree.insert(ft::make_pair(k, mapped_type())).first)).value->second;
+				bool is_left;
+				ft::pair<base_ptr, bool> res = _tree.get_insert_position(k, NULL, is_left);
+				if (res.second == false)
+					return (iterator(res.first)->second);
+				return (iterator(_tree.insert_at(res.first, is_left, value_type(k, mapped_type())))->second);
+			}
+#if __cplusplus >= 201103L
+			mapped_type& operator[](key_type&& k) {
+				bool is_left;
+				ft::pair<base_ptr, bool> res = _tree.get_insert_position(k, NULL, is_left);
+				if (res.second == false)
+					return (iterator(res.first)->second);
+				return (iterator(_tree.insert_at(res.first, is_left, value_type(std::move(k), mapped_type())))->second);
 			}
+#endif
 
 			// Modifiers
 			//1. single element
 			//insert 성공 - pair(새로운 element를 가리키는 iterator, true) 반환.
 			//insert 실패 - pair(val과 동일한 Key값 갖고있는 iterator, false) 반환.
 			pair<iterator, bool> insert(const value_type& val) {
-				ft::pair<node_type*, bool> res = _tree.insert(val);
+				ft::pair<base_ptr, bool> res = _tree.insert(val);
+				return (ft::make_pair(iterator(res.first), res.second));
+			}
+#if __cplusplus >= 201103L
+			// rvalue insert (c++11) - val의 mapped_type을 노드로 옮긴다.
+			pair<iterator, bool> insert(value_type&& val) {
+				ft::pair<base_ptr, bool> res = _tree.insert(std::move(val));
+				return (ft::make_pair(iterator(res.first), res.second));
+			}
+
+			iterator insert(iterator position, value_type&& val) {
+				return (iterator(this->_tree.insert(std::move(val), position.base()).first));
+			}
+
+			// 인자로 노드 안에 value_type을 바로 생성한 뒤 삽입한다. (c++11)
+			// 같은 key가 이미 있으면 만든 노드를 버리고 (그 요소, false)를 반환한다.
+			template <typename... Args>
+			pair<iterator, bool> emplace(Args&&... args) {
+				ft::pair<base_ptr, bool> res = _tree.emplace(NULL, std::forward<Args>(args)...);
 				return (ft::make_pair(iterator(res.first), res.second));
 			}
 
+			template <typename... Args>
+			iterator emplace_hint(iterator position, Args&&... args) {
+				return (iterator(_tree.emplace(position.base(), std::forward<Args>(args)...).first));
+			}
+#endif
+
+			//try_emplace (c++17)
+			//k가 이미 있으면 아무것도 만들지 않고 (그 요소, false)를 반환한다.
+			//k가 없을 때만 value_type(k, obj)를 만들어 탐색한 위치에 바로 연결한다.
+			pair<iterator, bool> try_emplace(const key_type& k, const mapped_type& obj) {
+				bool is_left;
+				ft::pair<base_ptr, bool> res = _tree.get_insert_position(k, NULL, is_left);
+				if (res.second == false)
+					return (ft::make_pair(iterator(res.first), false));
+				return (ft::make_pair(iterator(_tree.insert_at(res.first, is_left, value_type(k, obj))), true));
+			}
+
 			//2. with hint
 			//position은 hint, 강제가 아니다.
 			//insert 성공 - 새로운 element를 가리키는 iterator 반환.
@@ -141,11 +206,15 @@ namespace ft {
 			//[first, last) 구간의 element를 insert.
 			//이때, 기존 Key값과 중복되는 element는 추가하지 않는다.
 			//중복되지 않는 element만 추가한다.
+			//비어있는 map에 정렬된(중복 없는) 구간이 들어오면 한 번에 O(n)으로 tree를 만든다.
 			template <class InputIterator>
 			void insert(InputIterator first, InputIterator last,
 			typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) {
+				if (this->_tree.build_sorted(first, last, true, ft::iterator_category(first)))
+					return ;
+				//end()를 hint로 주면 정렬된 구간은 요소마다 O(1)로 뒤에 붙는다.
 				while (first != last)
-					this->_tree.insert(*first++);
+					this->_tree.insert(*first++, this->_tree.get_end());
 			}
 
 			void erase(iterator position) {
@@ -154,15 +223,14 @@ namespace ft {
 
 			//지워진 요소의 수를 반환
 			//erase 성공 시 1, 실패 시 0 리턴.
-			//tree에 없는 key_type k가 들어온 경우 find에서 nil노드를 리턴한다.
-			//nil노드 erase실행 시 실패.
+			//tree에 없는 key_type k가 들어온 경우 find에서 end(header)노드를 리턴한다.
+			//header노드 erase실행 시 실패.
 			size_type erase(const key_type& k) {
-				return (this->_tree.erase(_tree.find(value_type(k, mapped_type()))));
+				return (this->_tree.erase(_tree.find(k)));
 			}
 
 			void erase(iterator first, iterator last) {
-				while (first != last)
-					erase(first++);
+				this->_tree.erase(first.base(), last.base());
 			}
 
 			// 같은 유형의 다른 맵인 x의 요소로 기존 맵 요소를 교환한다. 이 때, 사이즈가 다를 수 있다.
@@ -176,11 +244,29 @@ namespace ft {
 				this->_tree.clear();
 			}
 
+			// key가 k 이상인 요소를 모두 other로 옮긴다. other에 있던 요소는 지운다.
+			// 노드를 새로 할당하지 않고 tree를 잘라 두 red-black tree로 만든다.
+			// 자르는 데는 O(log n)이지만, 기본 map은 서브트리 크기가 없어 양쪽 size()를 구하려고 작은 쪽을 센다.
+			// -> O(log n + min(|left|, |right|)), 가운데에서 나누면 O(n)이다.
+			// rb_size_augment를 쓰면 root의 크기를 읽으므로 O(log n)이다. -> shard를 자주 나누는 map은 rb_size_augment를 쓴다.
+			// 어느 쪽이든 reserve한 map이거나 allocator가 다르면 노드를 옮길 수 없어 요소를 복사한다. -> O(n)
+			void split(const key_type& k, map& other) {
+				this->_tree.split(k, other._tree);
+			}
+
+			// other의 요소를 모두 옮겨온다. (other는 비게 된다)
+			// other의 key가 모두 이 map의 key보다 크거나 모두 작으면 노드를 그대로 이어 붙인다. -> O(log n)
+			// key 범위가 겹치면 하나씩 넣으며, 이미 있는 key를 가진 요소는 other에 남는다.
+			// 어느 쪽이든 reserve한 map이거나 allocator가 다르면 하나씩 복사한다. -> O(|other| log n)
+			void join(map& other) {
+				this->_tree.join(other._tree, true);
+			}
+
 			//Observers
 			// 컨테이너가 키를 비교하는데 사용하며 비교 객체의 복사본을 반환한다
 			// key_comp가 키가 인수로 전달되는 순서에 관계없이 false를 반환하다면, 두 키는 동등한 것으로 간주한다.
 			key_compare key_comp() const {
-				return (key_compare());
+				return (this->_tree.key_comp());
 			}
 
 			// 두 개의 요소를 비교하여 첫 번째 요소의 키가 두 번쨰 요소보다 이전인지 확인하는데 사용할 수 있는 비교 개체(값)를 반환한다.
@@ -197,18 +283,18 @@ namespace ft {
 			// 컨테이너의 비교객체가 반사적으로 false를 반환하는 경우(요소가 인자로 전달되는 순서와 관계없이) 두 키는 동일한 것으로 간주
 			// map::count를 사용하여 특정키가 존재하는지 확인할 수 있다.
 			iterator find(const key_type& k) {
-				return (iterator(this->_tree.find(value_type(k, mapped_type()))));
+				return (iterator(this->_tree.find(k)));
 			}
 
 			const_iterator find(const key_type& k) const {
-				return (const_iterator(this->_tree.find(value_type(k, mapped_type()))));
+				return (const_iterator(this->_tree.find(k)));
 			}
 
 			// 컨테이너에서 k에 해당하는 키를 사용하여 요소를 검색하고 일치 항목 수를 반환한다.
 			// 맵 컨테이너의 모든 요소가 고유하기 때문에 함수는 1(요소가 발견된 경우) 또는 0(요소가 발견되지 않은 경우)만 반환 가능
 			// 컨테이너의 비교객체가 반사적으로 false를 반환하는 경우(요소가 인자로 전달되는 순서와 관계없이) 두 키는 동일한 것으로 간주
 			size_type count(const key_type& k) const {
-				if (this->_tree.find(value_type(k, mapped_type()))->value != NULL)
+				if (this->_tree.find(k) != this->_tree.get_end())
 					return (1);
 				else
 					return (0);
@@ -232,11 +318,11 @@ namespace ft {
 			// lower_bound는 그 요소를 가리키는 반복자를 반환
 			// upper_bound는 다음 요소를 가리키는 반복자를 반환
 			iterator lower_bound(const key_type& k) {
-				return (iterator(this->_tree.lower_bound(value_type(k, mapped_type()))));
+				return (iterator(this->_tree.lower_bound(k)));
 			}
 
 			const_iterator lower_bound(const key_type& k) const {
-				return (const_iterator(this->_tree.lower_bound(value_type(k, mapped_type()))));
+				return (const_iterator(this->_tree.lower_bound(k)));
 			}
 
 			// 키가 k 다음에 오는 것으로 간주되는 컨테이너의 첫 번째 요소를 가리키는 반복자를 반환한다.
@@ -249,10 +335,10 @@ namespace ft {
 			// lower_bound는 그 요소를 가리키는 반복자를 반환
 			// upper_bound는 다음 요소를 가리키는 반복자를 반환
 			iterator upper_bound(const key_type& k) {
-				return (iterator(this->_tree.upper_bound(value_type(k, mapped_type()))));
+				return (iterator(this->_tree.upper_bound(k)));
 			}
 			const_iterator upper_bound(const key_type& k) const {
-				return (const_iterator(this->_tree.upper_bound(value_type(k, mapped_type()))));
+				return (const_iterator(this->_tree.upper_bound(k)));
 			}
 
 			// k와 동등한 키를 가진 컨테이너의 모든 요소를 포함하는 범위의 경계를 반환한다.
@@ -267,9 +353,36 @@ namespace ft {
 				return (ft::make_pair(lower_bound(k), upper_bound(k)));
 			}
 
+			// Order statistics
+			// Augment가 서브트리 크기를 저장할 때만 쓸 수 있다. (ex. ft::rb_size_augment, ft::rb_monoid_augment)
+			// 중위 순회에서 i번째(0부터) 요소, i >= size()이면 end() -> O(log n)
+			iterator nth(size_type i) {
+				return (iterator(this->_tree.nth(i)));
+			}
+			const_iterator nth(size_type i) const {
+				return (const_iterator(this->_tree.nth(i)));
+			}
+			// key가 k보다 작은 요소의 개수 (lower_bound(k)의 위치)
+			size_type rank(const key_type& k) const {
+				return (this->_tree.rank(k));
+			}
+			// ft::distance(first, last)와 같지만 요소를 훑지 않고 O(log n)
+			difference_type distance(const_iterator first, const_iterator last) const {
+				return (static_cast<difference_type>(this->_tree.get_index(last.base()))
+					- static_cast<difference_type>(this->_tree.get_index(first.base())));
+			}
+			// key가 [lo, hi)인 요소를 Augment의 monoid로 합친 값 -> O(log n)
+			aggregate_type aggregate(const key_type& lo, const key_type& hi) const {
+				return (this->_tree.aggregate(lo, hi));
+			}
+			// mapped 값을 operator[]나 iterator로 바꾸면 tree가 알 수 없으므로, 바꾼 뒤 불러 aggregate를 다시 맞춘다. -> O(log n)
+			void refresh(iterator position) {
+				this->_tree.refresh(position.base());
+			}
+
 			// 맵과 연결된 allocator object의 복사본을 반환한다.
 			allocator_type get_allocator() const {
-				return (this->_alloc);
+				return (this->_tree.get_allocator());
 			}
 
 			void showTree() {
@@ -279,41 +392,331 @@ namespace ft {
 	}; // class map
 
 	// Relational operators
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator==(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) {
+	template <class Key, class T, class Compare, class Alloc, class Augment>
+	bool operator==(const map<Key, T, Compare, Alloc, Augment>& lhs, const map<Key, T, Compare, Alloc, Augment>& rhs) {
 		return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
 	}
 
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator!=(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) {
+	template <class Key, class T, class Compare, class Alloc, class Augment>
+	bool operator!=(const map<Key, T, Compare, Alloc, Augment>& lhs, const map<Key, T, Compare, Alloc, Augment>& rhs) {
 		return (!(lhs == rhs));
 	}
 
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator<(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) {
+	template <class Key, class T, class Compare, class Alloc, class Augment>
+	bool operator<(const map<Key, T, Compare, Alloc, Augment>& lhs, const map<Key, T, Compare, Alloc, Augment>& rhs) {
 		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
 	}
 
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator<=(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) {
+	template <class Key, class T, class Compare, class Alloc, class Augment>
+	bool operator<=(const map<Key, T, Compare, Alloc, Augment>& lhs, const map<Key, T, Compare, Alloc, Augment>& rhs) {
 		return (!(rhs < lhs));
 	}
 
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator>(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) {
+	template <class Key, class T, class Compare, class Alloc, class Augment>
+	bool operator>(const map<Key, T, Compare, Alloc, Augment>& lhs, const map<Key, T, Compare, Alloc, Augment>& rhs) {
 		return (rhs < lhs);
 	}
 
-	template <class Key, class T, class Compare, class Alloc>
-	bool operator>=(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) {
+	template <class Key, class T, class Compare, class Alloc, class Augment>
+	bool operator>=(const map<Key, T, Compare, Alloc, Augment>& lhs, const map<Key, T, Compare, Alloc, Augment>& rhs) {
 		return (!(lhs < rhs));
 	}
 
 	// swap
-	template <class Key, class T, class Compare, class Alloc>
-	void swap(map<Key, T, Compare, Alloc>& x, map<Key, T, Compare, Alloc>& y) {
+	template <class Key, class T, class Compare, class Alloc, class Augment>
+	void swap(map<Key, T, Compare, Alloc, Augment>& x, map<Key, T, Compare, Alloc, Augment>& y) {
 		x.swap(y);
 	}
+
+	// map의 swap은 트리의 포인터만 바꾸므로, map을 담은 벡터는 재할당 때 swap으로 옮긴다.
+	template <class Key, class T, class Compare, class Alloc, class Augment>
+	struct has_cheap_swap< map<Key, T, Compare, Alloc, Augment> > : public true_type {};
+
+	template <class Key, class T, class Compare, class Alloc, class Augment>
+	map<Key, T, Compare, Alloc, Augment> empty_like(const map<Key, T, Compare, Alloc, Augment>& src) {
+		return (map<Key, T, Compare, Alloc, Augment>(src.key_comp(), src.get_allocator()));
+	}
+
+	/*
+	 * multimap
+		같은 key를 여러 개 저장할 수 있는 map.
+		같은 key는 넣은 순서대로 놓인다. (hint를 준 경우에는 hint 바로 앞)
+		equal_range는 root부터 한 번만 내려가 찾으므로 같은 key가 몇 개이든 O(log n)이다.
+	*/
+	template < class Key,
+			class T,
+			class Compare = ft::less< Key >,
+			class Alloc = std::allocator< ft::pair< const Key, T > >,
+			class Augment = ft::rb_no_augment >
+	class multimap {
+		public:
+			// Member types
+			typedef Key key_type;
+			typedef T mapped_type;
+			typedef ft::pair< const key_type, mapped_type > value_type;
+			typedef Compare key_compare;
+
+			class value_compare : binary_function<value_type, value_type, bool>
+			{
+				friend class multimap;
+				protected:
+					Compare comp;
+					value_compare(Compare c) : comp(c) {}
+				public:
+					typedef value_type	first_argument_type;
+					typedef value_type	second_argument_type;
+					typedef bool		result_type;
+					bool operator()(const value_type& lhs, const value_type& rhs) const {
+						return (comp(lhs.first, rhs.first));
+					}
+			}; // class value_compare
+
+			typedef Alloc allocator_type;
+			typedef typename allocator_type::reference reference;
+			typedef typename allocator_type::const_reference const_reference;
+			typedef typename allocator_type::pointer pointer;
+			typedef typename allocator_type::const_pointer const_pointer;
+			typedef typename ft::RBTreeIterator<value_type, value_type*, value_type&> iterator;
+			typedef typename ft::RBTreeIterator<value_type, const value_type*, const value_type&> const_iterator;
+			typedef ft::reverse_iterator<iterator> reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+			typedef typename allocator_type::difference_type difference_type;
+			typedef typename allocator_type::size_type size_type;
+			typedef ft::RBTree<key_type, value_type, ft::select1st<value_type>, key_compare, allocator_type, Augment> rb_tree;
+			typedef typename rb_tree::result_type aggregate_type;
+			typedef typename rb_tree::base_ptr base_ptr;
+
+		private:
+			rb_tree _tree;
+
+		public:
+			// Member function
+			explicit multimap (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _tree(comp, alloc) {}
+			template <class InputIterator>
+			multimap (InputIterator first, InputIterator last,
+					const key_compare& comp = key_compare(),
+					const allocator_type& alloc = allocator_type(),
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) : _tree(comp, alloc) {
+				insert(first, last);
+			}
+			multimap(const multimap& x) : _tree(x._tree) {}
+			~multimap() {}
+			multimap& operator=(const multimap& x) {
+				if (this != &x)
+					this->_tree.copy(x._tree);
+				return (*this);
+			}
+#if __cplusplus >= 201103L
+			multimap(multimap&& x) : _tree(std::move(x._tree)) {}
+			multimap& operator=(multimap&& x) {
+				if (this != &x)
+					this->_tree = std::move(x._tree);
+				return (*this);
+			}
+#endif
+
+			// Iterators
+			iterator begin() { return (iterator(_tree.get_begin())); }
+			const_iterator begin() const { return (const_iterator(_tree.get_begin())); }
+			iterator end() { return (iterator(_tree.get_end())); }
+			const_iterator end() const { return (const_iterator(_tree.get_end())); }
+			reverse_iterator rbegin() { return (reverse_iterator(end())); }
+			const_reverse_iterator rbegin() const { return (const_reverse_iterator(end())); }
+			reverse_iterator rend() { return (reverse_iterator(begin())); }
+			const_reverse_iterator rend() const { return (const_reverse_iterator(begin())); }
+
+			// Capacity
+			bool empty() const { return (this->_tree.empty()); }
+			size_type size() const { return (this->_tree.size()); }
+			size_type max_size() const { return (this->_tree.max_size()); }
+			// 요소 n개를 담을 노드를 미리 한 번에 할당한다. (std::multimap에는 없는 확장)
+			void reserve(size_type n) {
+				this->_tree.reserve(n);
+			}
+
+			// Modifiers
+			// 항상 삽입되므로 새 요소를 가리키는 iterator만 반환한다.
+			iterator insert(const value_type& val) {
+				return (iterator(this->_tree.insert_equal(val)));
+			}
+			iterator insert(iterator position, const value_type& val) {
+				return (iterator(this->_tree.insert_equal(val, position.base())));
+			}
+#if __cplusplus >= 201103L
+			iterator insert(value_type&& val) {
+				return (iterator(this->_tree.insert_equal(std::move(val))));
+			}
+			iterator insert(iterator position, value_type&& val) {
+				return (iterator(this->_tree.insert_equal(std::move(val), position.base())));
+			}
+
+			template <typename... Args>
+			iterator emplace(Args&&... args) {
+				return (iterator(this->_tree.emplace_equal(NULL, std::forward<Args>(args)...)));
+			}
+
+			template <typename... Args>
+			iterator emplace_hint(iterator position, Args&&... args) {
+				return (iterator(this->_tree.emplace_equal(position.base(), std::forward<Args>(args)...)));
+			}
+#endif
+			// 비어있는 multimap에 정렬된 구간이 들어오면 한 번에 O(n)으로 tree를 만든다.
+			template <class InputIterator>
+			void insert(InputIterator first, InputIterator last,
+			typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) {
+				if (this->_tree.build_sorted(first, last, false, ft::iterator_category(first)))
+					return ;
+				while (first != last)
+					this->_tree.insert_equal(*first++, this->_tree.get_end());
+			}
+
+			void erase(iterator position) {
+				this->_tree.erase(position.base());
+			}
+			// k와 같은 key를 가진 요소를 모두 지우고 지운 개수를 반환한다.
+			// 구간을 한 번 찾은 뒤 이어서 지우므로 요소마다 root부터 다시 찾지 않는다.
+			size_type erase(const key_type& k) {
+				ft::pair<base_ptr, base_ptr> range = this->_tree.equal_range(k);
+				return (this->_tree.erase(range.first, range.second));
+			}
+			void erase(iterator first, iterator last) {
+				this->_tree.erase(first.base(), last.base());
+			}
+
+			void swap(multimap& x) {
+				this->_tree.swap(x._tree);
+			}
+			void clear() {
+				this->_tree.clear();
+			}
+
+			// Observers
+			key_compare key_comp() const {
+				return (this->_tree.key_comp());
+			}
+			value_compare value_comp() const {
+				return (value_compare(this->_tree.key_comp()));
+			}
+
+			// Operations
+			// 같은 key가 여러 개이면 그 중 가장 앞의 요소를 반환한다.
+			iterator find(const key_type& k) {
+				return (iterator(find_first(k)));
+			}
+			const_iterator find(const key_type& k) const {
+				return (const_iterator(find_first(k)));
+			}
+			size_type count(const key_type& k) const {
+				return (this->_tree.count(k));
+			}
+			iterator lower_bound(const key_type& k) {
+				return (iterator(this->_tree.lower_bound(k)));
+			}
+			const_iterator lower_bound(const key_type& k) const {
+				return (const_iterator(this->_tree.lower_bound(k)));
+			}
+			iterator upper_bound(const key_type& k) {
+				return (iterator(this->_tree.upper_bound(k)));
+			}
+			const_iterator upper_bound(const key_type& k) const {
+				return (const_iterator(this->_tree.upper_bound(k)));
+			}
+			pair<iterator, iterator> equal_range(const key_type& k) {
+				ft::pair<base_ptr, base_ptr> range = this->_tree.equal_range(k);
+				return (ft::make_pair(iterator(range.first), iterator(range.second)));
+			}
+			pair<const_iterator, const_iterator> equal_range(const key_type& k) const {
+				ft::pair<base_ptr, base_ptr> range = this->_tree.equal_range(k);
+				return (ft::make_pair(const_iterator(range.first), const_iterator(range.second)));
+			}
+
+			// Order statistics
+			// Augment가 서브트리 크기를 저장할 때만 쓸 수 있다. (ex. ft::rb_size_augment, ft::rb_monoid_augment)
+			// 중위 순회에서 i번째(0부터) 요소, i >= size()이면 end() -> O(log n)
+			iterator nth(size_type i) {
+				return (iterator(this->_tree.nth(i)));
+			}
+			const_iterator nth(size_type i) const {
+				return (const_iterator(this->_tree.nth(i)));
+			}
+			// key가 k보다 작은 요소의 개수 (lower_bound(k)의 위치)
+			size_type rank(const key_type& k) const {
+				return (this->_tree.rank(k));
+			}
+			// ft::distance(first, last)와 같지만 요소를 훑지 않고 O(log n)
+			difference_type distance(const_iterator first, const_iterator last) const {
+				return (static_cast<difference_type>(this->_tree.get_index(last.base()))
+					- static_cast<difference_type>(this->_tree.get_index(first.base())));
+			}
+			// key가 [lo, hi)인 요소를 Augment의 monoid로 합친 값 -> O(log n)
+			aggregate_type aggregate(const key_type& lo, const key_type& hi) const {
+				return (this->_tree.aggregate(lo, hi));
+			}
+			// mapped 값을 operator[]나 iterator로 바꾸면 tree가 알 수 없으므로, 바꾼 뒤 불러 aggregate를 다시 맞춘다. -> O(log n)
+			void refresh(iterator position) {
+				this->_tree.refresh(position.base());
+			}
+
+			allocator_type get_allocator() const {
+				return (this->_tree.get_allocator());
+			}
+
+		private:
+			base_ptr find_first(const key_type& k) const {
+				base_ptr res = this->_tree.lower_bound(k);
+				if (res == this->_tree.get_end() || key_comp()(k, const_iterator(res)->first))
+					return (this->_tree.get_end());
+				return (res);
+			}
+	}; // class multimap
+
+	template <class Key, class T, class Compare, class Alloc, class Augment>
+	bool operator==(const multimap<Key, T, Compare, Alloc, Augment>& lhs, const multimap<Key, T, Compare, Alloc, Augment>& rhs) {
+		return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class Key, class T, class Compare, class Alloc, class Augment>
+	bool operator!=(const multimap<Key, T, Compare, Alloc, Augment>& lhs, const multimap<Key, T, Compare, Alloc, Augment>& rhs) {
+		return (!(lhs == rhs));
+	}
+
+	template <class Key, class T, class Compare, class Alloc, class Augment>
+	bool operator<(const multimap<Key, T, Compare, Alloc, Augment>& lhs, const multimap<Key, T, Compare, Alloc, Augment>& rhs) {
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template <class Key, class T, class Compare, class Alloc, class Augment>
+	bool operator<=(const multimap<Key, T, Compare, Alloc, Augment>& lhs, const multimap<Key, T, Compare, Alloc, Augment>& rhs) {
+		return (!(rhs < lhs));
+	}
+
+	template <class Key, class T, class Compare, class Alloc, class Augment>
+	bool operator>(const multimap<Key, T, Compare, Alloc, Augment>& lhs, const multimap<Key, T, Compare, Alloc, Augment>& rhs) {
+		return (rhs < lhs);
+	}
+
+	template <class Key, class T, class Compare, class Alloc, class Augment>
+	bool operator>=(const multimap<Key, T, Compare, Alloc, Augment>& lhs, const multimap<Key, T, Compare, Alloc, Augment>& rhs) {
+		return (!(lhs < rhs));
+	}
+
+	template <class Key, class T, class Compare, class Alloc, class Augment>
+	void swap(multimap<Key, T, Compare, Alloc, Augment>& x, multimap<Key, T, Compare, Alloc, Augment>& y) {
+		x.swap(y);
+	}
+
+	template <class Key, class T, class Compare, class Alloc, class Augment>
+	struct has_cheap_swap< multimap<Key, T, Compare, Alloc, Augment> > : public true_type {};
+
+	template <class Key, class T, class Compare, class Alloc, class Augment>
+	multimap<Key, T, Compare, Alloc, Augment> empty_like(const multimap<Key, T, Compare, Alloc, Augment>& src) {
+		return (multimap<Key, T, Compare, Alloc, Augment>(src.key_comp(), src.get_allocator()));
+	}
+
+	// 기본 비교 객체 / allocator를 쓰는 map은 header 노드와 tree의 포인터, 개수만 가진다.
+	// (header, leftmost, size, node pool)
+	typedef char map_size_check[ft::static_check<(sizeof(map<int, int>)
+		== sizeof(RBTreeNodeBase) + 2 * sizeof(RBTreeNodeBase*) + sizeof(std::size_t))>::value];
 } // namespace ft
 
 #endif
@@ -10,12 +10,12 @@
 
 namespace ft {
 template < typename T >
-void printMap(RBTreeNode< T >* node, int depth) {
+void printMap(RBTreeNodeBase* node, int depth) {
   if (depth == 0) {
     std::cout << "// SHOW TREE //" << std::endl;
   }
   int tmp_depth = depth;
-  if (node->value == NULL) {
+  if (node->is_nil()) {
     while (tmp_depth--) {
       std::cout << "     ";
     }
@@ -25,15 +25,15 @@ void printMap(RBTreeNode< T >* node, int depth) {
   while (tmp_depth--) {
     std::cout << "     ";
   }
-  std::cout << (node->color ? C_RESET : C_RED)
-            << (node->parent->value == NULL ? "Root" : (node->parent->leftChild == node ? "L" : "R"))
-            << " - key: " << node->value->first << C_RESET << std::endl;
-  if (node->leftChild->value != NULL) {
+  std::cout << (node->get_color() == BLACK ? C_RESET : C_RED)
+            << (node->get_parent()->is_header() ? "Root" : (node->get_parent()->leftChild == node ? "L" : "R"))
+            << " - key: " << static_cast<RBTreeNode< T >*>(node)->value.first << C_RESET << std::endl;
+  if (!node->leftChild->is_nil()) {
     // std::cout << "left?" << std::endl;
-    printMap(node->leftChild, depth + 1);
+    printMap< T >(node->leftChild, depth + 1);
   }
-  if (node->rightChild->value != NULL) {
-    printMap(node->rightChild, depth + 1);
+  if (!node->rightChild->is_nil()) {
+    printMap< T >(node->rightChild, depth + 1);
   }
     // std::cout << "right?" << std::endl;
   return;
@@ -0,0 +1,468 @@
+#ifndef SET_HPP
+# define SET_HPP
+
+#include "RB_Tree.hpp"
+
+namespace ft {
+	/*
+	 * set
+		key만 저장하는 map. key가 곧 value이다.
+		map과 같은 RBTree를 쓰지만 KeyOfValue로 identity를 넘기므로 노드에는 pair가 아닌 key만 들어간다.
+		요소를 바꾸면 정렬 순서가 깨지므로 iterator와 const_iterator는 모두 const 요소를 가리킨다.
+	*/
+	template < class Key,	// set::key_type / set::value_type
+			class Compare = ft::less< Key >,	// set::key_compare / set::value_compare
+			class Alloc = std::allocator< Key >,	// set::allocator_type
+			class Augment = ft::rb_no_augment >	// 노드마다 서브트리의 값을 모아 저장하는 정책 (RB_Tree_augment.hpp)
+	class set {
+		public:
+			// Member types
+			typedef Key key_type;
+			typedef Key value_type;
+			typedef Compare key_compare;
+			typedef Compare value_compare;
+			typedef Alloc allocator_type;
+			typedef typename allocator_type::reference reference;
+			typedef typename allocator_type::const_reference const_reference;
+			typedef typename allocator_type::pointer pointer;
+			typedef typename allocator_type::const_pointer const_pointer;
+			typedef typename ft::RBTreeIterator<value_type, const value_type*, const value_type&> iterator;
+			typedef typename ft::RBTreeIterator<value_type, const value_type*, const value_type&> const_iterator;
+			typedef ft::reverse_iterator<iterator> reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+			typedef typename allocator_type::difference_type difference_type;
+			typedef typename allocator_type::size_type size_type;
+			typedef ft::RBTree<key_type, value_type, ft::identity<value_type>, key_compare, allocator_type, Augment> rb_tree;
+			typedef typename rb_tree::result_type aggregate_type;
+			typedef typename rb_tree::base_ptr base_ptr;
+
+		private:
+			rb_tree _tree;
+
+		public:
+			// Member function
+			// empty container constructor (default constructor)
+			explicit set (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _tree(comp, alloc) {}
+			// range constructor
+			template <class InputIterator>
+			set (InputIterator first, InputIterator last,
+					const key_compare& comp = key_compare(),
+					const allocator_type& alloc = allocator_type(),
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) : _tree(comp, alloc) {
+				insert(first, last);
+			}
+			// copy constructor
+			set(const set& x) : _tree(x._tree) {}
+			~set() {}
+			set& operator=(const set& x) {
+				if (this != &x)
+					this->_tree.copy(x._tree);
+				return (*this);
+			}
+#if __cplusplus >= 201103L
+			// move (c++11)
+			set(set&& x) : _tree(std::move(x._tree)) {}
+			set& operator=(set&& x) {
+				if (this != &x)
+					this->_tree = std::move(x._tree);
+				return (*this);
+			}
+#endif
+
+			// Iterators
+			iterator begin() const { return (iterator(_tree.get_begin())); }
+			iterator end() const { return (iterator(_tree.get_end())); }
+			reverse_iterator rbegin() const { return (reverse_iterator(end())); }
+			reverse_iterator rend() const { return (reverse_iterator(begin())); }
+
+			// Capacity
+			bool empty() const { return (this->_tree.empty()); }
+			size_type size() const { return (this->_tree.size()); }
+			size_type max_size() const { return (this->_tree.max_size()); }
+			// 요소 n개를 담을 노드를 미리 한 번에 할당한다. (std::set에는 없는 확장)
+			void reserve(size_type n) {
+				this->_tree.reserve(n);
+			}
+
+			// Modifiers
+			// 같은 값이 이미 있으면 노드를 만들지 않고 (그 요소, false)를 반환한다.
+			pair<iterator, bool> insert(const value_type& val) {
+				ft::pair<base_ptr, bool> res = _tree.insert(val);
+				return (ft::make_pair(iterator(res.first), res.second));
+			}
+			iterator insert(iterator position, const value_type& val) {
+				return (iterator(this->_tree.insert(val, position.base()).first));
+			}
+#if __cplusplus >= 201103L
+			pair<iterator, bool> insert(value_type&& val) {
+				ft::pair<base_ptr, bool> res = _tree.insert(std::move(val));
+				return (ft::make_pair(iterator(res.first), res.second));
+			}
+			iterator insert(iterator position, value_type&& val) {
+				return (iterator(this->_tree.insert(std::move(val), position.base()).first));
+			}
+
+			template <typename... Args>
+			pair<iterator, bool> emplace(Args&&... args) {
+				ft::pair<base_ptr, bool> res = _tree.emplace(NULL, std::forward<Args>(args)...);
+				return (ft::make_pair(iterator(res.first), res.second));
+			}
+
+			template <typename... Args>
+			iterator emplace_hint(iterator position, Args&&... args) {
+				return (iterator(_tree.emplace(position.base(), std::forward<Args>(args)...).first));
+			}
+#endif
+			// 비어있는 set에 정렬된(중복 없는) 구간이 들어오면 한 번에 O(n)으로 tree를 만든다.
+			template <class InputIterator>
+			void insert(InputIterator first, InputIterator last,
+			typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) {
+				if (this->_tree.build_sorted(first, last, true, ft::iterator_category(first)))
+					return ;
+				while (first != last)
+					this->_tree.insert(*first++, this->_tree.get_end());
+			}
+
+			void erase(iterator position) {
+				this->_tree.erase(position.base());
+			}
+			size_type erase(const value_type& val) {
+				return (this->_tree.erase(_tree.find(val)));
+			}
+			void erase(iterator first, iterator last) {
+				this->_tree.erase(first.base(), last.base());
+			}
+
+			void swap(set& x) {
+				this->_tree.swap(x._tree);
+			}
+			void clear() {
+				this->_tree.clear();
+			}
+
+			// Observers
+			key_compare key_comp() const {
+				return (this->_tree.key_comp());
+			}
+			value_compare value_comp() const {
+				return (this->_tree.key_comp());
+			}
+
+			// Operations
+			iterator find(const value_type& val) const {
+				return (iterator(this->_tree.find(val)));
+			}
+			size_type count(const value_type& val) const {
+				return (this->_tree.find(val) != this->_tree.get_end());
+			}
+			iterator lower_bound(const value_type& val) const {
+				return (iterator(this->_tree.lower_bound(val)));
+			}
+			iterator upper_bound(const value_type& val) const {
+				return (iterator(this->_tree.upper_bound(val)));
+			}
+			pair<iterator, iterator> equal_range(const value_type& val) const {
+				return (ft::make_pair(lower_bound(val), upper_bound(val)));
+			}
+
+			// Order statistics
+			// Augment가 서브트리 크기를 저장할 때만 쓸 수 있다. (ex. ft::rb_size_augment, ft::rb_monoid_augment)
+			// 중위 순회에서 i번째(0부터) 요소, i >= size()이면 end() -> O(log n)
+			iterator nth(size_type i) const {
+				return (iterator(this->_tree.nth(i)));
+			}
+			// key가 k보다 작은 요소의 개수 (lower_bound(k)의 위치)
+			size_type rank(const key_type& k) const {
+				return (this->_tree.rank(k));
+			}
+			// ft::distance(first, last)와 같지만 요소를 훑지 않고 O(log n)
+			difference_type distance(const_iterator first, const_iterator last) const {
+				return (static_cast<difference_type>(this->_tree.get_index(last.base()))
+					- static_cast<difference_type>(this->_tree.get_index(first.base())));
+			}
+			// key가 [lo, hi)인 요소를 Augment의 monoid로 합친 값 -> O(log n)
+			aggregate_type aggregate(const key_type& lo, const key_type& hi) const {
+				return (this->_tree.aggregate(lo, hi));
+			}
+
+			allocator_type get_allocator() const {
+				return (this->_tree.get_allocator());
+			}
+	}; // class set
+
+	/*
+	 * multiset
+		같은 값을 여러 개 저장할 수 있는 set.
+		같은 값은 넣은 순서대로 놓인다. (hint를 준 경우에는 hint 바로 앞)
+	*/
+	template < class Key,
+			class Compare = ft::less< Key >,
+			class Alloc = std::allocator< Key >,
+			class Augment = ft::rb_no_augment >
+	class multiset {
+		public:
+			// Member types
+			typedef Key key_type;
+			typedef Key value_type;
+			typedef Compare key_compare;
+			typedef Compare value_compare;
+			typedef Alloc allocator_type;
+			typedef typename allocator_type::reference reference;
+			typedef typename allocator_type::const_reference const_reference;
+			typedef typename allocator_type::pointer pointer;
+			typedef typename allocator_type::const_pointer const_pointer;
+			typedef typename ft::RBTreeIterator<value_type, const value_type*, const value_type&> iterator;
+			typedef typename ft::RBTreeIterator<value_type, const value_type*, const value_type&> const_iterator;
+			typedef ft::reverse_iterator<iterator> reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+			typedef typename allocator_type::difference_type difference_type;
+			typedef typename allocator_type::size_type size_type;
+			typedef ft::RBTree<key_type, value_type, ft::identity<value_type>, key_compare, allocator_type, Augment> rb_tree;
+			typedef typename rb_tree::result_type aggregate_type;
+			typedef typename rb_tree::base_ptr base_ptr;
+
+		private:
+			rb_tree _tree;
+
+		public:
+			// Member function
+			explicit multiset (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _tree(comp, alloc) {}
+			template <class InputIterator>
+			multiset (InputIterator first, InputIterator last,
+					const key_compare& comp = key_compare(),
+					const allocator_type& alloc = allocator_type(),
+					typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) : _tree(comp, alloc) {
+				insert(first, last);
+			}
+			multiset(const multiset& x) : _tree(x._tree) {}
+			~multiset() {}
+			multiset& operator=(const multiset& x) {
+				if (this != &x)
+					this->_tree.copy(x._tree);
+				return (*this);
+			}
+#if __cplusplus >= 201103L
+			multiset(multiset&& x) : _tree(std::move(x._tree)) {}
+			multiset& operator=(multiset&& x) {
+				if (this != &x)
+					this->_tree = std::move(x._tree);
+				return (*this);
+			}
+#endif
+
+			// Iterators
+			iterator begin() const { return (iterator(_tree.get_begin())); }
+			iterator end() const { return (iterator(_tree.get_end())); }
+			reverse_iterator rbegin() const { return (reverse_iterator(end())); }
+			reverse_iterator rend() const { return (reverse_iterator(begin())); }
+
+			// Capacity
+			bool empty() const { return (this->_tree.empty()); }
+			size_type size() const { return (this->_tree.size()); }
+			size_type max_size() const { return (this->_tree.max_size()); }
+			void reserve(size_type n) {
+				this->_tree.reserve(n);
+			}
+
+			// Modifiers
+			// 항상 삽입되므로 새 요소를 가리키는 iterator만 반환한다.
+			iterator insert(const value_type& val) {
+				return (iterator(this->_tree.insert_equal(val)));
+			}
+			iterator insert(iterator position, const value_type& val) {
+				return (iterator(this->_tree.insert_equal(val, position.base())));
+			}
+#if __cplusplus >= 201103L
+			iterator insert(value_type&& val) {
+				return (iterator(this->_tree.insert_equal(std::move(val))));
+			}
+			iterator insert(iterator position, value_type&& val) {
+				return (iterator(this->_tree.insert_equal(std::move(val), position.base())));
+			}
+
+			template <typename... Args>
+			iterator emplace(Args&&... args) {
+				return (iterator(this->_tree.emplace_equal(NULL, std::forward<Args>(args)...)));
+			}
+
+			template <typename... Args>
+			iterator emplace_hint(iterator position, Args&&... args) {
+				return (iterator(this->_tree.emplace_equal(position.base(), std::forward<Args>(args)...)));
+			}
+#endif
+			// 비어있는 multiset에 정렬된 구간이 들어오면 한 번에 O(n)으로 tree를 만든다.
+			template <class InputIterator>
+			void insert(InputIterator first, InputIterator last,
+			typename ft::enable_if<!ft::is_integral<InputIterator>::value, InputIterator>::type* = NULL) {
+				if (this->_tree.build_sorted(first, last, false, ft::iterator_category(first)))
+					return ;
+				while (first != last)
+					this->_tree.insert_equal(*first++, this->_tree.get_end());
+			}
+
+			void erase(iterator position) {
+				this->_tree.erase(position.base());
+			}
+			// val과 같은 요소를 모두 지우고 지운 개수를 반환한다.
+			// 구간을 한 번 찾은 뒤 이어서 지우므로 요소마다 root부터 다시 찾지 않는다.
+			size_type erase(const value_type& val) {
+				ft::pair<base_ptr, base_ptr> range = this->_tree.equal_range(val);
+				return (this->_tree.erase(range.first, range.second));
+			}
+			void erase(iterator first, iterator last) {
+				this->_tree.erase(first.base(), last.base());
+			}
+
+			void swap(multiset& x) {
+				this->_tree.swap(x._tree);
+			}
+			void clear() {
+				this->_tree.clear();
+			}
+
+			// Observers
+			key_compare key_comp() const {
+				return (this->_tree.key_comp());
+			}
+			value_compare value_comp() const {
+				return (this->_tree.key_comp());
+			}
+
+			// Operations
+			// 같은 값이 여러 개이면 그 중 가장 앞의 요소를 반환한다.
+			iterator find(const value_type& val) const {
+				iterator res = lower_bound(val);
+				if (res == end() || key_comp()(val, *res))
+					return (end());
+				return (res);
+			}
+			size_type count(const value_type& val) const {
+				return (this->_tree.count(val));
+			}
+			iterator lower_bound(const value_type& val) const {
+				return (iterator(this->_tree.lower_bound(val)));
+			}
+			iterator upper_bound(const value_type& val) const {
+				return (iterator(this->_tree.upper_bound(val)));
+			}
+			pair<iterator, iterator> equal_range(const value_type& val) const {
+				ft::pair<base_ptr, base_ptr> range = this->_tree.equal_range(val);
+				return (ft::make_pair(iterator(range.first), iterator(range.second)));
+			}
+
+			// Order statistics
+			// Augment가 서브트리 크기를 저장할 때만 쓸 수 있다. (ex. ft::rb_size_augment, ft::rb_monoid_augment)
+			// 중위 순회에서 i번째(0부터) 요소, i >= size()이면 end() -> O(log n)
+			iterator nth(size_type i) const {
+				return (iterator(this->_tree.nth(i)));
+			}
+			// key가 k보다 작은 요소의 개수 (lower_bound(k)의 위치)
+			size_type rank(const key_type& k) const {
+				return (this->_tree.rank(k));
+			}
+			// ft::distance(first, last)와 같지만 요소를 훑지 않고 O(log n)
+			difference_type distance(const_iterator first, const_iterator last) const {
+				return (static_cast<difference_type>(this->_tree.get_index(last.base()))
+					- static_cast<difference_type>(this->_tree.get_index(first.base())));
+			}
+			// key가 [lo, hi)인 요소를 Augment의 monoid로 합친 값 -> O(log n)
+			aggregate_type aggregate(const key_type& lo, const key_type& hi) const {
+				return (this->_tree.aggregate(lo, hi));
+			}
+
+			allocator_type get_allocator() const {
+				return (this->_tree.get_allocator());
+			}
+	}; // class multiset
+
+	// Relational operators
+	template <class Key, class Compare, class Alloc, class Augment>
+	bool operator==(const set<Key, Compare, Alloc, Augment>& lhs, const set<Key, Compare, Alloc, Augment>& rhs) {
+		return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class Key, class Compare, class Alloc, class Augment>
+	bool operator!=(const set<Key, Compare, Alloc, Augment>& lhs, const set<Key, Compare, Alloc, Augment>& rhs) {
+		return (!(lhs == rhs));
+	}
+
+	template <class Key, class Compare, class Alloc, class Augment>
+	bool operator<(const set<Key, Compare, Alloc, Augment>& lhs, const set<Key, Compare, Alloc, Augment>& rhs) {
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template <class Key, class Compare, class Alloc, class Augment>
+	bool operator<=(const set<Key, Compare, Alloc, Augment>& lhs, const set<Key, Compare, Alloc, Augment>& rhs) {
+		return (!(rhs < lhs));
+	}
+
+	template <class Key, class Compare, class Alloc, class Augment>
+	bool operator>(const set<Key, Compare, Alloc, Augment>& lhs, const set<Key, Compare, Alloc, Augment>& rhs) {
+		return (rhs < lhs);
+	}
+
+	template <class Key, class Compare, class Alloc, class Augment>
+	bool operator>=(const set<Key, Compare, Alloc, Augment>& lhs, const set<Key, Compare, Alloc, Augment>& rhs) {
+		return (!(lhs < rhs));
+	}
+
+	template <class Key, class Compare, class Alloc, class Augment>
+	bool operator==(const multiset<Key, Compare, Alloc, Augment>& lhs, const multiset<Key, Compare, Alloc, Augment>& rhs) {
+		return (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class Key, class Compare, class Alloc, class Augment>
+	bool operator!=(const multiset<Key, Compare, Alloc, Augment>& lhs, const multiset<Key, Compare, Alloc, Augment>& rhs) {
+		return (!(lhs == rhs));
+	}
+
+	template <class Key, class Compare, class Alloc, class Augment>
+	bool operator<(const multiset<Key, Compare, Alloc, Augment>& lhs, const multiset<Key, Compare, Alloc, Augment>& rhs) {
+		return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+	}
+
+	template <class Key, class Compare, class Alloc, class Augment>
+	bool operator<=(const multiset<Key, Compare, Alloc, Augment>& lhs, const multiset<Key, Compare, Alloc, Augment>& rhs) {
+		return (!(rhs < lhs));
+	}
+
+	template <class Key, class Compare, class Alloc, class Augment>
+	bool operator>(const multiset<Key, Compare, Alloc, Augment>& lhs, const multiset<Key, Compare, Alloc, Augment>& rhs) {
+		return (rhs < lhs);
+	}
+
+	template <class Key, class Compare, class Alloc, class Augment>
+	bool operator>=(const multiset<Key, Compare, Alloc, Augment>& lhs, const multiset<Key, Compare, Alloc, Augment>& rhs) {
+		return (!(lhs < rhs));
+	}
+
+	// swap
+	template <class Key, class Compare, class Alloc, class Augment>
+	void swap(set<Key, Compare, Alloc, Augment>& x, set<Key, Compare, Alloc, Augment>& y) {
+		x.swap(y);
+	}
+
+	template <class Key, class Compare, class Alloc, class Augment>
+	void swap(multiset<Key, Compare, Alloc, Augment>& x, multiset<Key, Compare, Alloc, Augment>& y) {
+		x.swap(y);
+	}
+
+	// set의 swap은 트리의 포인터만 바꾸므로, set을 담은 벡터는 재할당 때 swap으로 옮긴다.
+	template <class Key, class Compare, class Alloc, class Augment>
+	struct has_cheap_swap< set<Key, Compare, Alloc, Augment> > : public true_type {};
+
+	template <class Key, class Compare, class Alloc, class Augment>
+	set<Key, Compare, Alloc, Augment> empty_like(const set<Key, Compare, Alloc, Augment>& src) {
+		return (set<Key, Compare, Alloc, Augment>(src.key_comp(), src.get_allocator()));
+	}
+
+	template <class Key, class Compare, class Alloc, class Augment>
+	struct has_cheap_swap< multiset<Key, Compare, Alloc, Augment> > : public true_type {};
+
+	template <class Key, class Compare, class Alloc, class Augment>
+	multiset<Key, Compare, Alloc, Augment> empty_like(const multiset<Key, Compare, Alloc, Augment>& src) {
+		return (multiset<Key, Compare, Alloc, Augment>(src.key_comp(), src.get_allocator()));
+	}
+} // namespace ft
+
+#endif
@@ -23,7 +23,12 @@ namespace ft{
 		public:
 			// member-function
 			//constructor
+#if __cplusplus >= 201103L
+			// 기본 생성은 빈 컨테이너를 옮겨 온다. -> 복사할 수 없는 요소도 담을 수 있다.
+			explicit stack (const container_type& ctnr) : c(ctnr) {}
+#else
 			explicit stack (const container_type& ctnr = container_type()) : c(ctnr) {}
+#endif
 			stack(const stack& other) : c(other.c) {}
 			virtual ~stack() {}
 			stack& operator=(const stack& other) {
@@ -32,6 +37,15 @@ namespace ft{
 				}
 				return (*this);
 			}
+#if __cplusplus >= 201103L
+			// move (c++11)
+			explicit stack (container_type&& ctnr = container_type()) : c(std::move(ctnr)) {}
+			stack(stack&& other) : c(std::move(other.c)) {}
+			stack& operator=(stack&& other) {
+				this->c = std::move(other.c);
+				return (*this);
+			}
+#endif
 			// Returns whether the stack is empty
 			bool empty() const { return (this->c.empty()); }
 
@@ -41,6 +55,12 @@ namespace ft{
 			const value_type& top() const { return (this->c.back()); }
 
 			void push(const value_type& val) { this->c.push_back(val); }
+#if __cplusplus >= 201103L
+			void push(value_type&& val) { this->c.push_back(std::move(val)); }
+
+			template <typename... Args>
+			void emplace(Args&&... args) { this->c.emplace_back(std::forward<Args>(args)...); }
+#endif
 
 			void pop() {
 				this->c.pop_back();
@@ -1,11 +1,19 @@
 #ifndef UTILS_HPP
 # define UTILS_HPP
 
+#include <climits>
+#include <cstring>
+#include <string>
+#if __cplusplus >= 201103L
+# include <type_traits>
+# include <utility>
+#endif
 #include "iterator.hpp"
 
 namespace ft{
+	// input / forward / bidirectional iterator는 하나씩 세어야 한다.
 	template <typename InputIterator>
-	typename ft::iterator_traits<InputIterator>::difference_type distance(InputIterator first, InputIterator last)
+	typename ft::iterator_traits<InputIterator>::difference_type distance(InputIterator first, InputIterator last, ft::input_iterator_tag)
 	{
 		typename ft::iterator_traits<InputIterator>::difference_type n = 0;
 		while (first++ != last)
@@ -13,6 +21,19 @@ namespace ft{
 		return (n);
 	}
 
+	// random access iterator는 뺄셈 한 번으로 거리를 구한다. -> O(1)
+	template <typename RandomAccessIterator>
+	typename ft::iterator_traits<RandomAccessIterator>::difference_type distance(RandomAccessIterator first, RandomAccessIterator last, ft::random_access_iterator_tag)
+	{
+		return (last - first);
+	}
+
+	template <typename InputIterator>
+	typename ft::iterator_traits<InputIterator>::difference_type distance(InputIterator first, InputIterator last)
+	{
+		return (ft::distance(first, last, ft::iterator_category(first)));
+	}
+
 	// The type T is enabled as member type enable_if::type if Cond is true.
 	template <bool Cond, typename T = void>
 	struct enable_if {};
@@ -86,7 +107,197 @@ namespace ft{
 	// T가 integral type인지 식별하는 class.
 	// is_integral_type< T > 를 상속받아 T에 따라 type을 다르게 갖는다.
 	template <typename T>
-	struct is_integral : public is_integral_type<T> {};	// equal
+	struct is_integral : public is_integral_type<T> {};
+
+	// tag dispatch에 사용하는 참/거짓 타입
+	typedef integral_traits<true, bool>	true_type;
+	typedef integral_traits<false, bool>	false_type;
+
+	// 두 타입이 같은지 확인한다.
+	template <typename T, typename U>
+	struct is_same : public false_type {};
+
+	template <typename T>
+	struct is_same<T, T> : public true_type {};
+
+	/*
+	 * is_trivially_copyable
+		T를 memcpy/memmove로 복사하고, 소멸자 호출 없이 버려도 되는 타입인지 확인한다.
+		c++11 이상은 std::is_trivially_copyable을 따른다. -> POD 구조체도 memcpy/memmove로 옮긴다.
+		c++98에서는 컴파일러가 알려주지 않으므로 integral type, 부동소수점 타입, 포인터만 true이고,
+		POD 구조체는 사용자가 직접 특수화한다.
+		ex) template <> struct ft::is_trivially_copyable<MyPod> : public ft::true_type {};
+	*/
+#if __cplusplus >= 201103L
+	template <typename T>
+	struct is_trivially_copyable : public integral_traits<std::is_trivially_copyable<T>::value, bool> {};
+#else
+	template <typename T>
+	struct is_trivially_copyable_type : public integral_traits<is_integral<T>::value, bool> {};
+
+	template <>
+	struct is_trivially_copyable_type<float> : public true_type {};
+
+	template <>
+	struct is_trivially_copyable_type<double> : public true_type {};
+
+	template <>
+	struct is_trivially_copyable_type<long double> : public true_type {};
+
+	template <typename T>
+	struct is_trivially_copyable_type<T*> : public true_type {};
+
+	template <typename T>
+	struct is_trivially_copyable : public is_trivially_copyable_type<T> {};	// equal
+#endif
+
+	/*
+	 * has_cheap_swap
+		T의 swap이 내부 버퍼의 포인터만 바꾸는 O(1) 연산인지 확인한다.
+		true이면 컨테이너가 요소를 옮길 때 깊은 복사 대신 빈 요소(empty_like) + swap 으로 옮긴다.
+		(c++11 이상에서는 move 생성으로 옮기므로 c++98 빌드에서만 쓰인다)
+		std::basic_string은 여기서, ft::vector / ft::map은 각 헤더에서 특수화한다.
+		ex) template <> struct ft::has_cheap_swap<MyHandle> : public ft::true_type {};
+	*/
+	template <typename T>
+	struct has_cheap_swap : public false_type {};
+
+	template <typename CharT, typename Traits, typename Alloc>
+	struct has_cheap_swap< std::basic_string<CharT, Traits, Alloc> > : public true_type {};
+
+	/*
+	 * empty_like
+		swap으로 옮길 자리에 만들 빈 요소. 기본값은 기본 생성이다.
+		컨테이너는 src의 allocator(와 비교 함수)로 만든다.
+		-> arena_allocator처럼 기본 생성자가 없는 allocator를 쓰는 요소도 옮길 수 있다.
+		ft 컨테이너의 overload는 각 헤더에 있고, 호출하는 쪽에서 ADL로 찾는다.
+	*/
+	template <typename T>
+	T empty_like(const T&) {
+		return (T());
+	}
+
+	template <typename CharT, typename Traits, typename Alloc>
+	std::basic_string<CharT, Traits, Alloc> empty_like(const std::basic_string<CharT, Traits, Alloc>& src) {
+		return (std::basic_string<CharT, Traits, Alloc>(src.get_allocator()));
+	}
+
+	/*
+	 * is_class / is_empty
+		is_class - T가 class(struct, union) 타입인지 확인한다. -> 멤버 포인터(int T::*)를 만들 수 있는지로 판단
+		is_empty - T가 데이터 멤버(와 가상 함수)가 없는 class인지 확인한다.
+		-> T를 상속한 구조체가 T를 상속하지 않은 같은 구조체와 크기가 같으면 비어있다.
+		c++11 이상은 표준 trait을 쓰고, 상속할 수 없는 final class는 비어있지 않은 것으로 본다.
+	*/
+	template <typename T>
+	struct is_class_helper {
+		template <typename U> static char test(int U::*);
+		template <typename U> static long test(...);
+		static const bool value = (sizeof(test<T>(0)) == sizeof(char));
+	};
+
+	template <typename T>
+	struct is_class : public integral_traits<is_class_helper<T>::value, bool> {};
+
+#if __cplusplus >= 201402L
+	template <typename T>
+	struct is_empty : public integral_traits<std::is_empty<T>::value && !std::is_final<T>::value, bool> {};
+#elif __cplusplus >= 201103L
+	template <typename T>
+	struct is_empty : public integral_traits<std::is_empty<T>::value, bool> {};
+#else
+	template <typename T, bool = is_class<T>::value>
+	struct is_empty_helper {
+		static const bool value = false;
+	};
+
+	template <typename T>
+	struct is_empty_helper<T, true> {
+		struct derived : public T { int dummy; };
+		struct plain { int dummy; };
+		static const bool value = (sizeof(derived) == sizeof(plain));
+	};
+
+	template <typename T>
+	struct is_empty : public integral_traits<is_empty_helper<T>::value, bool> {};
+#endif
+
+	/*
+	 * ebo_storage
+		비교 객체, allocator 처럼 대부분 비어있는 객체를 저장한다.
+		비어있는 class이면 상속해서 저장하므로 크기를 차지하지 않는다. (empty base optimization)
+		아니면 (함수 포인터, 상태가 있는 비교 객체, arena_allocator 등) 멤버로 저장한다.
+		Tag - 한 컨테이너가 두 개를 상속할 때 서로 다른 base가 되도록 구분한다.
+		ex) class RBTree : private ft::ebo_storage<Compare, 0>, private ft::ebo_storage<Alloc, 1>
+	*/
+	template <typename T, int Tag, bool = is_empty<T>::value>
+	class ebo_storage {
+		private:
+			T	_value;
+
+		public:
+			explicit ebo_storage(const T& value) : _value(value) {}
+
+			T& get() { return (this->_value); }
+			const T& get() const { return (this->_value); }
+	};
+
+	template <typename T, int Tag>
+	class ebo_storage<T, Tag, true> : private T {
+		public:
+			explicit ebo_storage(const T& value) : T(value) {}
+
+			T& get() { return (*this); }
+			const T& get() const { return (*this); }
+	};
+
+	/*
+	 * static_check
+		c++98에서 쓰는 컴파일 타임 검사. (c++11의 static_assert 대신)
+		조건이 false이면 정의되지 않은 특수화의 멤버를 찾게 되어 컴파일 에러가 나고, typedef 이름이 에러 메시지에 보인다.
+		ex) typedef char int_is_4_bytes[ft::static_check<(sizeof(int) == 4)>::value];
+	*/
+	template <bool Condition>
+	struct static_check;
+
+	template <>
+	struct static_check<true> {
+		enum { value = 1 };
+	};
+
+	/*
+	 * is_memcmp_equal / is_memcmp_less
+		T 배열의 == 를 memcmp 결과가 0인지로 판단해도 되는지 확인한다.
+		-> padding이 없고 같은 값이 항상 같은 바이트인 integral type. (부동소수점은 NaN, -0.0 때문에 제외)
+		T 배열의 < 를 memcmp 의 부호로 판단해도 되는지 확인한다.
+		-> memcmp는 unsigned char로 비교하므로 unsigned 1바이트 타입만. (char는 unsigned인 플랫폼에서만)
+	*/
+	template <typename T>
+	struct is_memcmp_equal : public is_integral<T> {};
+
+	template <typename T>
+	struct is_memcmp_less : public false_type {};
+
+	template <>
+	struct is_memcmp_less<unsigned char> : public true_type {};
+
+	template <>
+	struct is_memcmp_less<char> : public integral_traits<(CHAR_MIN == 0), bool> {};
+
+	// 두 반복자가 같은 타입의 연속된 메모리를 가리키고, 그 타입을 memcmp로 비교할 수 있는지 확인한다.
+	template <class Iterator1, class Iterator2>
+	struct use_memcmp_equal : public integral_traits<
+		ft::contiguous_iterator<Iterator1>::value && ft::contiguous_iterator<Iterator2>::value
+		&& ft::is_same<typename ft::contiguous_iterator<Iterator1>::value_type,
+			typename ft::contiguous_iterator<Iterator2>::value_type>::value
+		&& ft::is_memcmp_equal<typename ft::contiguous_iterator<Iterator1>::value_type>::value, bool> {};
+
+	template <class Iterator1, class Iterator2>
+	struct use_memcmp_less : public integral_traits<
+		ft::contiguous_iterator<Iterator1>::value && ft::contiguous_iterator<Iterator2>::value
+		&& ft::is_same<typename ft::contiguous_iterator<Iterator1>::value_type,
+			typename ft::contiguous_iterator<Iterator2>::value_type>::value
+		&& ft::is_memcmp_less<typename ft::contiguous_iterator<Iterator1>::value_type>::value, bool> {};
 
 	/* first1, last1
 		첫 번째 시퀀스의 초기 및 최종 위치에 반복자를 입력합니다 .
@@ -97,7 +308,7 @@ namespace ft{
 		비교에는 범위에 있는 요소 수만큼 이 시퀀스의 요소가 포함됩니다 [first1,last1)
 	*/
 	template <class InputIterator1, class InputIterator2>
-	bool equal (InputIterator1 first1, InputIterator1 last1, InputIterator2 first2) {
+	bool equal_dispatch (InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, ft::false_type) {
 		while (first1 != last1) {
 			if (!(*first1 == *first2))
 				return (false);
@@ -107,6 +318,23 @@ namespace ft{
 		return (true);
 	};
 
+	// 연속된 integral 배열은 memcmp 한 번으로 비교한다. (glibc memcmp는 CPU에 맞는 SIMD 구현을 고른다)
+	template <class Iterator1, class Iterator2>
+	bool equal_dispatch (Iterator1 first1, Iterator1 last1, Iterator2 first2, ft::true_type) {
+		typedef typename ft::contiguous_iterator<Iterator1>::value_type value_type;
+		std::size_t n = last1 - first1;
+
+		if (n == 0)
+			return (true);
+		return (std::memcmp(ft::contiguous_iterator<Iterator1>::address(first1),
+				ft::contiguous_iterator<Iterator2>::address(first2), n * sizeof(value_type)) == 0);
+	}
+
+	template <class InputIterator1, class InputIterator2>
+	bool equal (InputIterator1 first1, InputIterator1 last1, InputIterator2 first2) {
+		return (ft::equal_dispatch(first1, last1, first2, ft::use_memcmp_equal<InputIterator1, InputIterator2>()));
+	};
+
 	// iterator범위 사이에서 동일한지 check. : pred로 비교.
 	/* pred
 		두 요소를 인수로 받아들이고(같은 순서로 두 시퀀스 각각 중 하나) 부울로 변환 가능한 값을 반환하는 이진 함수입니다.
@@ -129,8 +357,8 @@ namespace ft{
 	// lexicographical compare
 	// default
 	template <class InputIterator1, class InputIterator2>
-	bool lexicographical_compare (InputIterator1 first1, InputIterator1 last1,
-								InputIterator2 first2, InputIterator2 last2) {
+	bool lexicographical_compare_dispatch (InputIterator1 first1, InputIterator1 last1,
+								InputIterator2 first2, InputIterator2 last2, ft::false_type) {
 		while (first1 != last1) {
 			if (first2 == last2 || *first2 < *first1)
 				return (false);
@@ -142,6 +370,30 @@ namespace ft{
 		return (first2 != last2);
 	};
 
+	// 연속된 unsigned 1바이트 배열은 memcmp 의 부호로 순서를 정하고, 같으면 짧은 쪽이 작다.
+	template <class Iterator1, class Iterator2>
+	bool lexicographical_compare_dispatch (Iterator1 first1, Iterator1 last1,
+								Iterator2 first2, Iterator2 last2, ft::true_type) {
+		std::size_t n1 = last1 - first1;
+		std::size_t n2 = last2 - first2;
+		std::size_t n = n1 < n2 ? n1 : n2;
+
+		if (n != 0) {
+			int res = std::memcmp(ft::contiguous_iterator<Iterator1>::address(first1),
+					ft::contiguous_iterator<Iterator2>::address(first2), n);
+			if (res != 0)
+				return (res < 0);
+		}
+		return (n1 < n2);
+	}
+
+	template <class InputIterator1, class InputIterator2>
+	bool lexicographical_compare (InputIterator1 first1, InputIterator1 last1,
+								InputIterator2 first2, InputIterator2 last2) {
+		return (ft::lexicographical_compare_dispatch(first1, last1, first2, last2,
+				ft::use_memcmp_less<InputIterator1, InputIterator2>()));
+	};
+
 	// custom
 	// binary comparison function comp
 	// comparison function object (i.e. an object that satisfies the requirements of Compare)
@@ -173,6 +425,7 @@ namespace ft{
 			//default
 			pair() : first(), second() {}
 			//copy
+			pair (const pair& pr) : first(pr.first), second(pr.second) {}
 			template<class U, class V> pair (const pair<U, V>& pr) : first(pr.first), second(pr.second) {}
 			//initialization
 			pair(const first_type& a, const second_type& b) : first(a), second(b) {}
@@ -184,12 +437,31 @@ namespace ft{
 				}
 				return (*this);
 			}
+#if __cplusplus >= 201103L
+			//move (c++11)
+			pair(pair&& pr) : first(std::move(pr.first)), second(std::move(pr.second)) {}
+			template<class U, class V> pair (pair<U, V>&& pr)
+				: first(std::forward<U>(pr.first)), second(std::forward<V>(pr.second)) {}
+			// 두 인자로 바로 생성할 수 있을 때만 사용한다. (NULL처럼 변환이 필요한 인자는 위의 const& 생성자로 간다)
+			template<class U, class V, class = typename std::enable_if<
+				std::is_constructible<first_type, U&&>::value && std::is_constructible<second_type, V&&>::value>::type>
+			pair(U&& a, V&& b) : first(std::forward<U>(a)), second(std::forward<V>(b)) {}
+			pair& operator= (pair&& pr) {
+				this->first = std::move(pr.first);
+				this->second = std::move(pr.second);
+				return (*this);
+			}
+#endif
 	}; // class pair
 
 	// 변수1(x), 변수2(y)가 들어간 pair를 만들어준다
 	template <class T1, class T2>
 	pair<T1, T2> make_pair(T1 x, T2 y) {
+#if __cplusplus >= 201103L
+		return (pair<T1, T2>(std::move(x), std::move(y)));
+#else
 		return (pair<T1, T2>(x,y));
+#endif
 	};
 
 	template <class T1, class T2>
@@ -232,6 +504,31 @@ namespace ft{
 		typedef Result result_type;
 	};
 
+	// pair에서 key(first)만 꺼내는 함수 객체
+	// RBTree가 value_type 전체가 아닌 key만 비교할 수 있게 한다.
+	template <class Pair>
+	struct select1st {
+		const typename Pair::first_type& operator()(const Pair& x) const {
+			return (x.first);
+		}
+	};
+
+	// pair에서 second만 꺼내는 함수 객체 (ex. map의 mapped 값을 모으는 sum_monoid)
+	template <class Pair>
+	struct select2nd {
+		const typename Pair::second_type& operator()(const Pair& x) const {
+			return (x.second);
+		}
+	};
+
+	// value 자체가 key인 경우 (set) value를 그대로 key로 쓰는 함수 객체
+	template <class T>
+	struct identity {
+		const T& operator()(const T& x) const {
+			return (x);
+		}
+	};
+
 	// operator< 와 동일한 반환값을 가진다.
 	template <class T>
 	struct less : binary_function<T, T, bool> {
@@ -239,6 +536,52 @@ namespace ft{
 			return (x < y);
 		}
 	};
+
+	/*
+	 * three_way_compare
+		key 두 개를 한 번에 비교해 음수(a < b), 0(같음), 양수(a > b)를 반환한다.
+		value가 true이면 RBTree는 탐색할 때 노드마다 비교를 한 번만 한다.
+		false이면 Compare(less)만으로 탐색하고, compare는 less를 두 번 불러 결과를 만든다.
+		- 비교 객체에 int compare(const Key&, const Key&) const 멤버가 있으면 그것을 쓴다.
+		- ft::less<std::basic_string>은 basic_string::compare를 쓴다.
+		ex) struct by_name {
+				bool operator()(const std::string& a, const std::string& b) const;
+				int compare(const std::string& a, const std::string& b) const;
+			};
+	*/
+	template <typename Compare, typename Key>
+	struct has_compare_member {
+		template <typename U, int (U::*)(const Key&, const Key&) const> struct check;
+		template <typename U> static char test(check<U, &U::compare>*);
+		template <typename U> static long test(...);
+		static const bool value = (sizeof(test<Compare>(0)) == sizeof(char));
+	};
+
+	template <typename Compare, typename Key, bool = has_compare_member<Compare, Key>::value>
+	struct three_way_compare : public false_type {
+		static int compare(const Compare& comp, const Key& a, const Key& b) {
+			if (comp(a, b))
+				return (-1);
+			return (comp(b, a) ? 1 : 0);
+		}
+	};
+
+	template <typename Compare, typename Key>
+	struct three_way_compare<Compare, Key, true> : public true_type {
+		static int compare(const Compare& comp, const Key& a, const Key& b) {
+			return (comp.compare(a, b));
+		}
+	};
+
+	template <typename CharT, typename Traits, typename Alloc>
+	struct three_way_compare< ft::less< std::basic_string<CharT, Traits, Alloc> >, std::basic_string<CharT, Traits, Alloc>, false >
+		: public true_type {
+		typedef std::basic_string<CharT, Traits, Alloc>	string_type;
+
+		static int compare(const ft::less<string_type>&, const string_type& a, const string_type& b) {
+			return (a.compare(b));
+		}
+	};
 }	// namespace ft
 
 
@@ -1,14 +1,37 @@
 #ifndef VECTOR_HPP
 #define VECTOR_HPP
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
 #include <stdexcept>
 #include "vector_iterator.hpp"
 #include "utils.hpp"
 
 namespace ft {
+	/*
+	 * vector growth policy
+		재할당이 필요할 때 현재 size로부터 새 capacity를 정한다.
+		vector는 이 값과 (size + 추가할 개수) 중 큰 값을 할당하므로 여러 번 넣어도 재할당은 O(log n)번이다.
+	*/
+	// 2배 (기본값, std::vector와 같은 capacity)
+	struct vector_growth_double {
+		static std::size_t next_capacity(std::size_t size) { return (size * 2); }
+	};
+
+	// 1.5배 (버려진 버퍼를 다음 할당에서 재사용하기 쉽다)
+	struct vector_growth_one_half {
+		static std::size_t next_capacity(std::size_t size) { return (size + size / 2); }
+	};
+
+	// 요소 타입별로 growth policy를 고른다. 사용자가 특수화해서 바꿀 수 있다.
+	// ex) template <> struct ft::vector_growth<MyType> : public ft::vector_growth_one_half {};
+	template < typename T >
+	struct vector_growth : public vector_growth_double {};
+
+	// allocator는 대부분 비어있으므로 ebo_storage를 상속해 저장한다. -> 포인터 3개 크기
 	template < typename T, typename Allocator = std::allocator< T > >
-	class vector {
+	class vector : private ft::ebo_storage< Allocator, 0 > {
 		public:
 			typedef T value_type; // 컨테이너에 담을 변수 타입 저장
 			typedef Allocator allocator_type; // allocator의 타입과 reference, pointer
@@ -24,7 +47,10 @@ namespace ft {
 			typedef typename allocator_type::difference_type difference_type; // Signed integer type, 노드 간 거리 연산을 위한 타입
 
 		private:
-			allocator_type _alloc;
+#if __cplusplus >= 201103L
+			typedef std::allocator_traits<allocator_type> alloc_traits;
+#endif
+			typedef ft::ebo_storage<allocator_type, 0> alloc_base;
 			pointer _begin; // 벡터 배열
 			pointer _end; // 백터의 현재 위치
 			pointer _end_capacity; // 벡터 저장공간의 마지막 위치
@@ -33,17 +59,20 @@ namespace ft {
 			// empty container constructor (default constructor)
 			// -> Constructs an empty container, with no elements.
 			explicit vector (const allocator_type& alloc = allocator_type())
-				: _alloc(alloc), _begin(NULL), _end(NULL), _end_capacity(NULL) {}
+				: alloc_base(alloc), _begin(NULL), _end(NULL), _end_capacity(NULL) {}
 
 			// fill constructor
 			// -> Constructs a container with n elements. Each element is a copy of val.
 			explicit vector (size_type n, const value_type& val = value_type(),
-				const allocator_type& alloc = allocator_type()) : _alloc(alloc) {
-				this->_begin = this->_alloc.allocate(n);
+				const allocator_type& alloc = allocator_type())
+					: alloc_base(alloc), _begin(NULL), _end(NULL), _end_capacity(NULL) {
+				if (n == 0)
+					return ;
+				this->_begin = this->get_alloc().allocate(n);
 				this->_end = this->_begin;
 				this->_end_capacity = this->_begin + n;
 				for (; n > 0; n--) {
-					this->_alloc.construct(this->_end, val);
+					this->get_alloc().construct(this->_end, val);
 					this->_end++;
 				}
 			}
@@ -54,35 +83,38 @@ namespace ft {
 			vector(InputIterator first, InputIterator last,
 				const allocator_type &alloc = allocator_type(),
 				typename ft::enable_if< !ft::is_integral< InputIterator >::value, InputIterator >::type* = NULL)
-					: _alloc(alloc), _begin(NULL), _end(NULL), _end_capacity(NULL) {
-				difference_type n = ft::distance(first, last);
-
-				this->_begin = this->_alloc.allocate(n);
-				this->_end = this->_begin;
-				this->_end_capacity = this->_begin + n;
-				while (n--)
-					this->_alloc.construct(this->_end++, *first++);
+					: alloc_base(alloc), _begin(NULL), _end(NULL), _end_capacity(NULL) {
+				this->range_init(first, last, ft::iterator_category(first));
 			}
 
 			// copy constructor
-			vector (const vector& x) : _alloc(x._alloc), _begin(NULL), _end(NULL), _end_capacity(NULL) {
+			// 빈 벡터를 복사하면 할당하지 않는다. -> 재할당 때 빈 요소(empty_like)를 만드는 비용이 포인터 3개로 끝난다.
+			vector (const vector& x) : alloc_base(x.get_alloc()), _begin(NULL), _end(NULL), _end_capacity(NULL) {
 				difference_type n = x._end - x._begin;
 
-				this->_begin = this->_alloc.allocate(n);
+				if (n == 0)
+					return ;
+				this->_begin = this->get_alloc().allocate(n);
 				this->_end = this->_begin;
-				iterator tmp_begin = x._begin;
-				iterator tmp_end = x._end;
-				for (; tmp_begin != tmp_end; tmp_begin++) {
-					this->_alloc.construct(this->_end, *tmp_begin);
-					this->_end++;
-				}
-				this->_end_capacity = this->_end;
+				this->_end_capacity = this->_begin + n;
+				copy_construct(this->_begin, x._begin, x._end);
+				this->_end = this->_begin + n;
 			}
 
+#if __cplusplus >= 201103L
+			// move constructor (c++11)
+			// x의 버퍼를 그대로 가져오고 x는 빈 벡터가 된다.
+			vector (vector&& x) : alloc_base(x.get_alloc()), _begin(x._begin), _end(x._end), _end_capacity(x._end_capacity) {
+				x._begin = NULL;
+				x._end = NULL;
+				x._end_capacity = NULL;
+			}
+#endif
+
 			// destructor
 			~vector() {
 				this->clear();
-				this->_alloc.deallocate(this->_begin, this->capacity());
+				this->get_alloc().deallocate(this->_begin, this->capacity());
 			}
 
 			vector &operator=(const vector &x) {
@@ -93,6 +125,24 @@ namespace ft {
 				return (*this);
 			}
 
+#if __cplusplus >= 201103L
+			// move assignment (c++11)
+			vector &operator=(vector &&x) {
+				if (this != &x) {
+					this->clear();
+					this->get_alloc().deallocate(this->_begin, this->capacity());
+					this->get_alloc() = x.get_alloc();
+					this->_begin = x._begin;
+					this->_end = x._end;
+					this->_end_capacity = x._end_capacity;
+					x._begin = NULL;
+					x._end = NULL;
+					x._end_capacity = NULL;
+				}
+				return (*this);
+			}
+#endif
+
 
 			iterator begin() { return (iterator(this->_begin)); }
 			const_iterator begin() const { return (const_iterator(this->_begin)); }
@@ -108,7 +158,7 @@ namespace ft {
 			}
 
 			size_type size() const { return (this->_end - this->_begin); }
-			size_type max_size() const { return (this->_alloc.max_size()); }
+			size_type max_size() const { return (this->get_alloc().max_size()); }
 
 
 			// n개의 val값들을 갖는 vector로 resize한다.
@@ -140,15 +190,11 @@ namespace ft {
 					pointer prev_end = this->_end;
 					pointer prev_end_capacity = this->_end_capacity;
 
-					this->_begin = this->_alloc.allocate(n);
-					this->_end = this->_begin;
+					this->_begin = this->get_alloc().allocate(n);
+					this->_end = this->_begin + (prev_end - prev_begin);
 					this->_end_capacity = this->_begin + n;
-					pointer tmp = prev_begin;
-					while (tmp != prev_end) {
-						this->_alloc.construct(this->_end++, *tmp);
-						this->_alloc.destroy(tmp++);
-					}
-					this->_alloc.deallocate(prev_begin, prev_end_capacity - prev_begin);
+					relocate(this->_begin, prev_begin, prev_end);
+					this->get_alloc().deallocate(prev_begin, prev_end_capacity - prev_begin);
 				}
 			}
 
@@ -184,182 +230,156 @@ namespace ft {
 			void assign(InputIterator first, InputIterator last,
 						typename ft::enable_if< !ft::is_integral< InputIterator >::value,
 						InputIterator >::type * = NULL) {
-				this->clear();
-				size_type n = ft::distance(first, last);
-				if (n <= this->capacity()) {
-					while (n--)
-						this->_alloc.construct(this->_end++, *first++);
-				}
-				else {
-					pointer prev_begin = this->_begin;
-					pointer prev_end_capacity = this->_end_capacity;
-
-					this->_begin = this->_alloc.allocate(n);
-					this->_end = this->_begin;
-					this->_end_capacity = this->_begin + n;
-					const_pointer tmp = &(*first);
-					while(tmp != &(*last))
-						this->_alloc.construct(this->_end++, *tmp++);
-					this->_alloc.deallocate(prev_begin, prev_end_capacity - prev_begin);
-				}
+				this->assign_range(first, last, ft::iterator_category(first));
 			}
 			//assign fill
 			void assign(size_type n, const value_type &val) {
 				this->clear();
 				if (n <= this->capacity()) {
 					while (n--)
-						this->_alloc.construct(this->_end++, val);
+						this->get_alloc().construct(this->_end++, val);
 				}
 				else {
 					pointer prev_begin = this->_begin;
 					pointer prev_end_capacity = this->_end_capacity;
 
-					this->_begin = this->_alloc.allocate(n);
+					this->_begin = this->get_alloc().allocate(n);
 					this->_end = this->_begin;
 					this->_end_capacity = this->_begin + n;
 					while (n--)
-						this->_alloc.construct(this->_end++, val);
-					this->_alloc.deallocate(prev_begin, prev_end_capacity - prev_begin);
+						this->get_alloc().construct(this->_end++, val);
+					this->get_alloc().deallocate(prev_begin, prev_end_capacity - prev_begin);
 				}
 			}
 
 			// 벡터의 뒤에 새로운 element를 추가한다.
-			// 늘어난 벡터의 크기가 capacity를 넘어갈 경우, 이전 capacity * 2의 크기로 늘어남.
+			// 늘어난 벡터의 크기가 capacity를 넘어갈 경우, growth policy에 따라 늘어남. (기본 2배)
+			// 재할당할 때는 새 버퍼에 val을 먼저 만든 뒤 기존 요소를 옮긴다. (val이 이 벡터의 요소여도 안전하다)
 			void push_back(const value_type &val) {
 				if (this->_end == this->_end_capacity) {
-					if (this->size() == 0)
-						this->reserve(1);
-					else
-						this->reserve(this->capacity() * 2);
+					size_type new_capacity = this->recommend_capacity(1);
+					pointer new_begin = this->get_alloc().allocate(new_capacity);
+					try {
+						this->get_alloc().construct(new_begin + this->size(), val);
+					}
+					catch (...) {
+						this->get_alloc().deallocate(new_begin, new_capacity);
+						throw;
+					}
+					this->finish_append(new_begin, new_capacity);
+				}
+				else
+					this->get_alloc().construct(this->_end++, val);
+			}
+
+#if __cplusplus >= 201103L
+			// rvalue push_back (c++11)
+			void push_back(value_type &&val) {
+				this->emplace_back(std::move(val));
+			}
+
+			// 인자로 요소를 벡터의 끝 자리에 바로 생성한다. (c++11)
+			template <typename... Args>
+			reference emplace_back(Args&&... args) {
+				if (this->_end == this->_end_capacity) {
+					size_type new_capacity = this->recommend_capacity(1);
+					pointer new_begin = this->get_alloc().allocate(new_capacity);
+					try {
+						alloc_traits::construct(this->get_alloc(), new_begin + this->size(), std::forward<Args>(args)...);
+					}
+					catch (...) {
+						this->get_alloc().deallocate(new_begin, new_capacity);
+						throw;
+					}
+					this->finish_append(new_begin, new_capacity);
+				}
+				else {
+					alloc_traits::construct(this->get_alloc(), this->_end, std::forward<Args>(args)...);
+					++this->_end;
 				}
-				this->_alloc.construct(this->_end++, val);
+				return (this->back());
 			}
+#endif
 
 			// 벡터의 맨 뒤 요소를 하나 제거한다.
-			void pop_back() { this->_alloc.destroy(--this->_end); }
+			void pop_back() { this->get_alloc().destroy(--this->_end); }
 
 			//1.single element insert
 			iterator insert(iterator position, const value_type &val) {
-				size_type n = &(*position) - this->_begin;
+				size_type n = position - this->begin();
 				this->insert(position, 1, val);
 				return (this->begin() + n);
 			}
 
-			//2.fill element insert
-			void insert(iterator position, size_type n, const value_type &val) {
-				if (this->size() + n <= this->capacity()) {
-					pointer val_tmp = this->_end;
-					size_type range = this->_end - &(*position);
-					this->_end += n;
-					pointer tmp = this->_end;
-					while (range--)
-						this->_alloc.construct(--tmp, *(--val_tmp));
-					while (n--)
-						this->_alloc.construct(--tmp, val);
-				}
+#if __cplusplus >= 201103L
+			// rvalue insert (c++11)
+			iterator insert(iterator position, value_type &&val) {
+				return (this->emplace(position, std::move(val)));
+			}
+
+			// 인자로 요소를 position 자리에 생성한다. (c++11)
+			// 인자가 이 벡터의 요소를 가리킬 수 있으므로 요소를 옮기기 전에 먼저 만들어 둔다.
+			template <typename... Args>
+			iterator emplace(iterator position, Args&&... args) {
+				size_type n = position - this->begin();
+				if (position == this->end())
+					this->emplace_back(std::forward<Args>(args)...);
 				else {
-					pointer tmp = this->_begin;
-					size_type _size = n + this->size();
-					size_type front_tmp = &(*position) - this->_begin;
-					size_type back_tmp = _end - &(*position);
-					this->_begin = _alloc.allocate(_size);
-					this->_end = _begin;
-					this->_end_capacity = this->_begin + _size;
-					while (front_tmp--) {
-						_alloc.construct(this->_end++, *tmp);
-						_alloc.destroy(tmp++);
-					}
-					while (n--)
-						_alloc.construct(this->_end++, val);
-					while (back_tmp--) {
-						_alloc.construct(this->_end++, *tmp);
-						_alloc.destroy(tmp++);
-					}
+					value_type tmp(std::forward<Args>(args)...);
+					alloc_traits::construct(this->get_alloc(), this->open_gap(position.base(), 1), std::move(tmp));
 				}
+				return (this->begin() + n);
+			}
+#endif
+
+			//2.fill element insert
+			void insert(iterator position, size_type n, const value_type &val) {
+				// val이 이 벡터의 요소일 수도 있으므로 요소를 옮기기 전에 복사해 둔다.
+				const value_type copy(val);
+				pointer pos = this->open_gap(position.base(), n);
+				while (n--)
+					this->get_alloc().construct(pos++, copy);
 			}
 
 			//3.range element instert
 			template < typename InputIterator >
 			void insert(iterator position, InputIterator first, InputIterator last,
 				typename ft::enable_if< !ft::is_integral< InputIterator >::value >::type* = NULL) {
-				size_type n = ft::distance(first, last);
-				if (this->size() + n <= this->capacity()) {
-					pointer val_tmp = this->_end;
-					size_type range = this->_end - &(*position);
-					this->_end += n;
-					pointer tmp = this->_end;
-					while (range--)
-						this->_alloc.construct(--tmp, *(--val_tmp));
-					while (n--)
-						this->_alloc.construct(--tmp, *(--last));
-				}
-				else {
-					pointer tmp = this->_begin;
-					size_type _size = n + this->size();
-					size_type front_tmp = &(*position) - this->_begin;
-					size_type back_tmp = this->_end - &(*position);
-					this->_begin = this->_alloc.allocate(_size);
-					this->_end = this->_begin;
-					this->_end_capacity = this->_begin + _size;
-					while (front_tmp--) {
-						_alloc.construct(this->_end++, *tmp);
-						_alloc.destroy(tmp++);
-					}
-					while (n--)
-						_alloc.construct(this->_end++, *first++);
-					while (back_tmp--) {
-						_alloc.construct(this->_end++, *tmp);
-						_alloc.destroy(tmp++);
-					}
-				}
+				this->insert_range(position, first, last, ft::iterator_category(first));
 			}
 
 			//단일 요소(위치) 제거
 			iterator erase(iterator position) {
-				this->_alloc.destroy(&(*position));
-				size_type n = this->_end - &(*position) - 1;
-				pointer tmp = &(*position);
-
-				while (n--) {
-					this->_alloc.construct(tmp, *(tmp + 1));
-					this->_alloc.destroy(tmp++);
-				}
+				pointer pos = position.base();
+				this->get_alloc().destroy(pos);
+				relocate(pos, pos + 1, this->_end);
 				--this->_end;
 				return (position);
 			}
 
 			//범위[first, last) 제거
 			iterator erase(iterator first, iterator last) {
-				pointer tmp = &(*first);
-				while (tmp != &(*last))
-					_alloc.destroy(tmp++);
-				size_type n = this->_end - &(*last);
-				size_type erase_size = ft::distance(first, last);
-				tmp = &(*first);
-				while (n--)
-				{
-					_alloc.construct(tmp, *last++);
-					_alloc.destroy(tmp++);
-				}
-				this->_end -= erase_size;
+				pointer tmp = first.base();
+				while (tmp != last.base())
+					this->get_alloc().destroy(tmp++);
+				relocate(first.base(), last.base(), this->_end);
+				this->_end -= ft::distance(first, last);
 				return (first);
 			}
 
+			// 요소를 비교하거나 복사하지 않고 버퍼 포인터만 맞바꾼다. -> O(1)
 			void swap(vector &x) {
-				if (*this == x)
-					return ;
-
-				allocator_type tmp_alloc = x._alloc;
+				allocator_type tmp_alloc = x.get_alloc();
 				pointer tmp_begin = x._begin;
 				pointer tmp_end = x._end;
 				pointer tmp_end_capacity = x._end_capacity;
 
-				x._alloc = this->_alloc;
+				x.get_alloc() = this->get_alloc();
 				x._begin = this->_begin;
 				x._end = this->_end;
 				x._end_capacity = this->_end_capacity;
 
-				this->_alloc = tmp_alloc;
+				this->get_alloc() = tmp_alloc;
 				this->_begin = tmp_begin;
 				this->_end = tmp_end;
 				this->_end_capacity = tmp_end_capacity;
@@ -367,13 +387,237 @@ namespace ft {
 
 			void clear() {
 				while (this->_end != this->_begin) {
-					this->_alloc.destroy(--this->_end);
+					this->get_alloc().destroy(--this->_end);
 				}
 			}
 
+			// 외부에서 채운 버퍼를 복사 없이 넘겨받는다.
+			// buffer는 이 벡터의 allocator로 capacity 만큼 할당되어 있어야 하고, 앞의 size개 요소는 생성되어 있어야 한다.
+			// 벡터가 이미 버퍼를 갖고 있으면 기존 요소를 모두 소멸시키고 그 버퍼를 이 벡터의 allocator로 해제한 뒤 buffer를 받는다.
+			// -> buffer가 지금 이 벡터의 버퍼(또는 그 일부)이면 안 된다.
+			void adopt(pointer buffer, size_type size, size_type capacity) {
+				this->clear();
+				this->get_alloc().deallocate(this->_begin, this->capacity());
+				this->_begin = buffer;
+				this->_end = buffer + size;
+				this->_end_capacity = buffer + capacity;
+			}
+
+			// 버퍼의 소유권을 넘기고 빈 벡터가 된다. (요소는 소멸시키지 않는다)
+			// 호출 전에 size() / capacity()를 받아 두고, 받은 쪽에서 요소를 소멸시킨 뒤 get_allocator()로 해제한다.
+			pointer release() {
+				pointer res = this->_begin;
+
+				this->_begin = NULL;
+				this->_end = NULL;
+				this->_end_capacity = NULL;
+				return (res);
+			}
+
 			//allocator
 			//벡터와 연결된 할당자 객체의 복사본을 반환한다.
-			allocator_type get_allocator() const { return (this->_alloc); }
+			allocator_type get_allocator() const { return (this->get_alloc()); }
+
+		private:
+			allocator_type& get_alloc() { return (alloc_base::get()); }
+			const allocator_type& get_alloc() const { return (alloc_base::get()); }
+
+			// range constructor / assign / range insert 는 iterator category에 따라 나눈다.
+			// input iterator - 한 번만 지나갈 수 있으므로 개수를 미리 셀 수 없다. -> 뒤에 하나씩 붙인다.
+			// forward iterator 이상 - 개수를 세어 한 번에 할당한 뒤 복사한다. (random access는 O(1)로 센다)
+			template <typename InputIterator>
+			void range_init(InputIterator first, InputIterator last, ft::input_iterator_tag) {
+				for (; first != last; ++first)
+					this->push_back(*first);
+			}
+
+			template <typename ForwardIterator>
+			void range_init(ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag) {
+				size_type n = ft::distance(first, last);
+
+				if (n == 0)
+					return ;
+				this->_begin = this->get_alloc().allocate(n);
+				this->_end_capacity = this->_begin + n;
+				copy_construct(this->_begin, first, last);
+				this->_end = this->_begin + n;
+			}
+
+			template <typename InputIterator>
+			void assign_range(InputIterator first, InputIterator last, ft::input_iterator_tag) {
+				this->clear();
+				for (; first != last; ++first)
+					this->push_back(*first);
+			}
+
+			template <typename ForwardIterator>
+			void assign_range(ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag) {
+				size_type n = ft::distance(first, last);
+
+				this->clear();
+				if (n > this->capacity()) {
+					this->get_alloc().deallocate(this->_begin, this->capacity());
+					this->_begin = this->get_alloc().allocate(n);
+					this->_end_capacity = this->_begin + n;
+				}
+				copy_construct(this->_begin, first, last);
+				this->_end = this->_begin + n;
+			}
+
+			// 끝에 넣을 때는 그대로 붙이고, 중간에 넣을 때는 임시 벡터에 모은 뒤 한 번에 넣는다.
+			template <typename InputIterator>
+			void insert_range(iterator position, InputIterator first, InputIterator last, ft::input_iterator_tag) {
+				if (position == this->end()) {
+					for (; first != last; ++first)
+						this->push_back(*first);
+				}
+				else {
+					vector tmp(first, last, this->get_alloc());
+					this->insert_range(position, tmp.begin(), tmp.end(), ft::forward_iterator_tag());
+				}
+			}
+
+			template <typename ForwardIterator>
+			void insert_range(iterator position, ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag) {
+				size_type n = ft::distance(first, last);
+				copy_construct(this->open_gap(position.base(), n), first, last);
+			}
+
+			// size()에서 n개를 더 넣을 때 할당할 capacity를 growth policy로 정한다.
+			size_type recommend_capacity(size_type n) const {
+				const size_type max = this->max_size();
+				const size_type size = this->size();
+
+				if (n > max - size)
+					throw(std::length_error("Error: ft::vector::length"));
+				size_type res = ft::vector_growth<value_type>::next_capacity(size);
+				if (res < size || res > max) // overflow
+					res = max;
+				return (res < size + n ? size + n : res);
+			}
+
+			// push_back / emplace_back 의 재할당: 새 요소가 만들어진 new_begin으로 기존 요소를 옮기고 이전 버퍼를 해제한다.
+			void finish_append(pointer new_begin, size_type new_capacity) {
+				size_type size = this->size();
+
+				relocate(new_begin, this->_begin, this->_end);
+				this->get_alloc().deallocate(this->_begin, this->capacity());
+				this->_begin = new_begin;
+				this->_end = new_begin + size + 1;
+				this->_end_capacity = new_begin + new_capacity;
+			}
+
+			// pos 앞에 초기화되지 않은 칸 n개를 만들고 그 시작 위치를 반환한다.
+			// capacity가 충분하면 pos 뒤의 요소들을 n칸 뒤로 옮기고,
+			// 부족하면 growth policy만큼 새로 할당해 앞/뒤 요소를 옮긴 뒤 이전 버퍼를 해제한다.
+			pointer open_gap(pointer pos, size_type n) {
+				if (this->size() + n <= this->capacity()) {
+					relocate(pos + n, pos, this->_end);
+					this->_end += n;
+					return (pos);
+				}
+				size_type new_capacity = this->recommend_capacity(n);
+				pointer prev_begin = this->_begin;
+				pointer prev_end = this->_end;
+				size_type prev_capacity = this->capacity();
+
+				this->_begin = this->get_alloc().allocate(new_capacity);
+				this->_end_capacity = this->_begin + new_capacity;
+				pointer gap = this->_begin + (pos - prev_begin);
+				relocate(this->_begin, prev_begin, pos);
+				relocate(gap + n, pos, prev_end);
+				this->_end = this->_begin + (prev_end - prev_begin) + n;
+				this->get_alloc().deallocate(prev_begin, prev_capacity);
+				return (gap);
+			}
+
+			// [first, last)를 초기화되지 않은 dst에 복사한다.
+			template <typename ForwardIterator>
+			void copy_construct(pointer dst, ForwardIterator first, ForwardIterator last) {
+				for (; first != last; ++first, ++dst)
+					this->get_alloc().construct(dst, *first);
+			}
+
+			// 연속된 메모리 구간(pointer, vector iterator)은 trivially copyable 이면 memcpy 한 번으로 복사한다.
+			void copy_construct(pointer dst, iterator first, iterator last) {
+				copy_construct(dst, const_pointer(first.base()), const_pointer(last.base()));
+			}
+
+			void copy_construct(pointer dst, const_iterator first, const_iterator last) {
+				copy_construct(dst, const_pointer(first.base()), const_pointer(last.base()));
+			}
+
+			void copy_construct(pointer dst, pointer first, pointer last) {
+				copy_construct(dst, const_pointer(first), const_pointer(last));
+			}
+
+			void copy_construct(pointer dst, const_pointer first, const_pointer last) {
+				copy_construct(dst, first, last, ft::is_trivially_copyable<value_type>());
+			}
+
+			void copy_construct(pointer dst, const_pointer first, const_pointer last, ft::true_type) {
+				if (first != last)
+					std::memcpy(static_cast<void*>(dst), static_cast<const void*>(first), (last - first) * sizeof(value_type));
+			}
+
+			void copy_construct(pointer dst, const_pointer first, const_pointer last, ft::false_type) {
+				for (; first != last; ++first, ++dst)
+					this->get_alloc().construct(dst, *first);
+			}
+
+			// [first, last)의 요소를 초기화되지 않은 dst로 옮기고 원래 자리의 요소는 소멸시킨다.
+			// 같은 버퍼 안에서 앞/뒤로 미는 경우처럼 두 구간이 겹쳐도 된다.
+			// trivially copyable 타입은 memmove 한 번으로 옮긴다.
+			void relocate(pointer dst, pointer first, pointer last) {
+				relocate(dst, first, last, ft::is_trivially_copyable<value_type>());
+			}
+
+			void relocate(pointer dst, pointer first, pointer last, ft::true_type) {
+				if (first != last && dst != first)
+					std::memmove(static_cast<void*>(dst), static_cast<const void*>(first), (last - first) * sizeof(value_type));
+			}
+
+			void relocate(pointer dst, pointer first, pointer last, ft::false_type) {
+				if (dst == first)
+					return ;
+				// 앞으로 옮길 때는 앞에서부터, 뒤로 옮길 때는 뒤에서부터 옮겨야 덮어쓰지 않는다.
+				if (dst < first) {
+					for (; first != last; ++first, ++dst)
+						relocate_one(dst, first);
+				}
+				else {
+					dst += last - first;
+					while (last != first)
+						relocate_one(--dst, --last);
+				}
+			}
+
+#if __cplusplus >= 201103L
+			// c++11 이상은 move 생성으로 옮긴다.
+			void relocate_one(pointer dst, pointer src) {
+				alloc_traits::construct(this->get_alloc(), dst, std::move(*src));
+				alloc_traits::destroy(this->get_alloc(), src);
+			}
+#else
+			void relocate_one(pointer dst, pointer src) {
+				relocate_one(dst, src, ft::has_cheap_swap<value_type>());
+			}
+
+			// swap이 싸면 src와 같은 allocator로 빈 요소를 만든 뒤 swap 한다. -> 내부 버퍼를 다시 할당하지 않는다.
+			void relocate_one(pointer dst, pointer src, ft::true_type) {
+				using std::swap;
+				using ft::empty_like;
+
+				this->get_alloc().construct(dst, empty_like(*src));
+				swap(*dst, *src);
+				this->get_alloc().destroy(src);
+			}
+
+			void relocate_one(pointer dst, pointer src, ft::false_type) {
+				this->get_alloc().construct(dst, *src);
+				this->get_alloc().destroy(src);
+			}
+#endif
 	}; // class vector
 
 	// vector non-member function
@@ -412,6 +656,18 @@ namespace ft {
 	void swap(vector< T, Alloc > &x, vector< T, Alloc > &y) {
 		x.swap(y);
 	}
+
+	// 벡터의 swap은 포인터만 바꾸므로, 벡터를 담은 벡터는 재할당 때 swap으로 옮긴다.
+	template <typename T, typename Alloc>
+	struct has_cheap_swap< vector< T, Alloc > > : public true_type {};
+
+	template <typename T, typename Alloc>
+	vector< T, Alloc > empty_like(const vector< T, Alloc > &src) {
+		return (vector< T, Alloc >(src.get_allocator()));
+	}
+
+	// 기본 allocator를 쓰는 vector는 포인터 3개 크기여야 한다. (allocator가 자리를 차지하지 않는다)
+	typedef char vector_size_check[ft::static_check<(sizeof(vector<int>) == 3 * sizeof(int*))>::value];
 }  // namespace ft
 
 #endif
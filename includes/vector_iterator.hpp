@@ -85,6 +85,21 @@ namespace ft {
 				return (*(this->_ptr + n));
 			}
 	}; // class vector_iterator
+
+	// vector_iterator는 포인터를 감싼 것이므로 연속된 메모리를 가리킨다.
+	template < typename T >
+	struct contiguous_iterator< vector_iterator<T> > {
+		static const bool value = true;
+		typedef T value_type;
+		static const T* address(const vector_iterator<T>& it) { return (it.base()); }
+	};
+
+	template < typename T >
+	struct contiguous_iterator< vector_iterator<const T> > {
+		static const bool value = true;
+		typedef T value_type;
+		static const T* address(const vector_iterator<const T>& it) { return (it.base()); }
+	};
 	//Relational operators
 	template <class Iter1, class Iter2>
 	bool operator==(const vector_iterator<Iter1>& lhs, const vector_iterator<Iter2>& rhs) {
@@ -0,0 +1,151 @@
+#include "arena_allocator.hpp"
+#include "vector.hpp"
+#include "map.hpp"
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#ifndef TESTED_NAMESPACE
+#define TESTED_NAMESPACE ft
+#endif
+
+// arena 자체는 ft에만 있으므로 두 빌드에서 같은 결과가 나와야 한다.
+// 컨테이너는 TESTED_NAMESPACE의 것을 arena_allocator로 만들어 std와 비교한다.
+
+struct Request {
+	std::size_t size;
+	std::size_t align;
+};
+
+static bool is_aligned(const void* ptr, std::size_t align) {
+	return (reinterpret_cast<std::size_t>(ptr) % align == 0);
+}
+
+// 받은 구간을 자기 번호로 채운 뒤, 나중에 모두 그대로인지 확인한다. -> 구간이 겹치면 다른 번호가 남는다.
+static bool check_requests(ft::arena& arena, const Request* req, std::size_t n) {
+	std::vector<unsigned char*> ptrs;
+	bool aligned = true;
+	for (std::size_t i = 0; i < n; ++i) {
+		unsigned char* ptr = static_cast<unsigned char*>(arena.allocate(req[i].size, req[i].align));
+		if (!is_aligned(ptr, req[i].align))
+			aligned = false;
+		std::memset(ptr, static_cast<int>(i + 1), req[i].size);
+		ptrs.push_back(ptr);
+	}
+	bool intact = true;
+	for (std::size_t i = 0; i < n; ++i) {
+		for (std::size_t j = 0; j < req[i].size; ++j) {
+			if (ptrs[i][j] != static_cast<unsigned char>(i + 1))
+				intact = false;
+		}
+	}
+	std::cout << "aligned: " << (aligned ? "OK" : "KO") << std::endl;
+	std::cout << "no overlap: " << (intact ? "OK" : "KO") << std::endl;
+	return (aligned && intact);
+}
+
+template <typename M>
+void printMap(const M& mp) {
+	std::cout << "size: " << mp.size() << std::endl;
+	for (typename M::const_iterator it = mp.begin(); it != mp.end(); ++it)
+		std::cout << "- key: " << it->first << "\t& value: " << it->second << std::endl;
+	std::cout << "------------------------" << std::endl;
+}
+
+int main() {
+	std::cout << "################ Test Arena ################" << std::endl;
+	std::cout << "===== allocate | alignment =====" << std::endl;
+	{
+		// 홀수 크기 다음에 정렬이 큰 요청이 오면 정렬한 위치가 블록 끝을 넘을 수 있다.
+		ft::arena arena;
+		unsigned char* odd = static_cast<unsigned char*>(arena.allocate(70001, 1));
+		unsigned char* aligned = static_cast<unsigned char*>(arena.allocate(8, 8));
+		std::memset(odd, 1, 70001);
+		std::memset(aligned, 2, 8);
+		std::cout << "aligned after odd block: " << (is_aligned(aligned, 8) ? "OK" : "KO") << std::endl;
+		std::cout << "new block past the end: " << arena.block_count() << std::endl;
+	}
+	{
+		// 작은 블록에 크기 / 정렬이 섞인 요청을 넣어 블록 경계를 여러 번 넘긴다.
+		const Request req[] = {
+			{ 1, 1 }, { 3, 2 }, { 8, 8 }, { 5, 1 }, { 16, 16 }, { 7, 4 }, { 300, 1 }, { 8, 8 },
+			{ 1, 1 }, { 32, 16 }, { 250, 1 }, { 24, 8 }, { 2, 2 }, { 16, 16 }, { 255, 1 }, { 8, 8 },
+			{ 13, 1 }, { 64, 16 }, { 4, 4 }, { 1, 1 }, { 16, 16 }, { 200, 8 }, { 3, 1 }, { 8, 8 }
+		};
+		ft::arena arena(256);
+		check_requests(arena, req, sizeof(req) / sizeof(req[0]));
+		std::cout << "blocks: " << arena.block_count() << std::endl;
+		arena.release();
+		std::cout << "after release: " << arena.block_count() << std::endl;
+		check_requests(arena, req, sizeof(req) / sizeof(req[0]));
+	}
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== scope rewind =====" << std::endl;
+	{
+		ft::arena arena(1024);
+		arena.allocate(100, 8);
+		void* inside;
+		{
+			ft::arena::scope outer(arena);
+			inside = arena.allocate(64, 16);
+			{
+				ft::arena::scope inner(arena);
+				arena.allocate(5000, 8);
+				arena.allocate(3, 1);
+				std::cout << "blocks in inner scope: " << arena.block_count() << std::endl;
+			}
+			std::cout << "blocks after inner scope: " << arena.block_count() << std::endl;
+			std::cout << "outer allocation kept: " << ((arena.allocate(1, 1) != inside) ? "OK" : "KO") << std::endl;
+		}
+		std::cout << "blocks after outer scope: " << arena.block_count() << std::endl;
+		std::cout << "position rewound: " << ((arena.allocate(64, 16) == inside) ? "OK" : "KO") << std::endl;
+	}
+	{
+		// 블록이 없을 때 만든 scope는 블록을 모두 해제한다.
+		ft::arena arena(128);
+		{
+			ft::arena::scope scope(arena);
+			arena.allocate(1000, 8);
+			arena.allocate(10, 1);
+		}
+		std::cout << "scope on empty arena: " << arena.block_count() << std::endl;
+		const Request req[] = { { 9, 1 }, { 16, 16 }, { 130, 8 }, { 1, 1 }, { 8, 8 } };
+		check_requests(arena, req, sizeof(req) / sizeof(req[0]));
+	}
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== containers on arena =====" << std::endl;
+	{
+		ft::arena arena(512);
+		ft::arena_allocator<int> alloc(arena);
+		TESTED_NAMESPACE::vector<int, ft::arena_allocator<int> > vec(alloc);
+		for (int i = 0; i < 100; ++i)
+			vec.push_back(i * 3);
+		vec.erase(vec.begin() + 10, vec.begin() + 90);
+		vec.insert(vec.begin() + 5, 4, 7);
+		std::cout << "size: " << vec.size() << std::endl;
+		for (std::size_t i = 0; i < vec.size(); ++i)
+			std::cout << vec[i] << " ";
+		std::cout << std::endl;
+
+		typedef TESTED_NAMESPACE::pair<const int, std::string> value_type;
+		typedef TESTED_NAMESPACE::map<int, std::string, TESTED_NAMESPACE::less<int>, ft::arena_allocator<value_type> > arena_map;
+		for (int round = 0; round < 3; ++round) {
+			ft::arena::scope scope(arena);
+			arena_map mp(TESTED_NAMESPACE::less<int>(), arena);
+			for (int i = 0; i < 50; ++i)
+				mp[(i * 7) % 50] = std::string(i % 5 + 1, static_cast<char>('a' + round));
+			for (int i = 0; i < 50; i += 3)
+				mp.erase(i);
+			arena_map mp_copy(mp);
+			mp_copy.erase(mp_copy.begin(), mp_copy.find(40));
+			if (round == 2)
+				printMap(mp_copy);
+			std::cout << "round " << round << " size: " << mp.size() << std::endl;
+		}
+		std::cout << "vector survives map scopes: " << vec.front() << " " << vec.back() << std::endl;
+	}
+}
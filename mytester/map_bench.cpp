@@ -0,0 +1,602 @@
+#include "arena_allocator.hpp"
+#include "map.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <new>
+#include <string>
+#include <vector>
+
+#ifndef TESTED_NAMESPACE
+#define TESTED_NAMESPACE ft
+#endif
+
+#define T1 int
+#define T2 int
+#define MAP TESTED_NAMESPACE::map<T1, T2>
+
+// 힙 할당 횟수와 요청 바이트를 세기 위해 전역 operator new를 교체한다.
+#if __cplusplus >= 201103L
+# define BENCH_THROW_BAD_ALLOC
+#else
+# define BENCH_THROW_BAD_ALLOC throw(std::bad_alloc)
+#endif
+
+// 교체한 operator new/delete가 인라인되면 gcc가 malloc/free 짝을 오인하므로 인라인을 막는다.
+#if defined(__GNUC__)
+# define BENCH_NOINLINE __attribute__((noinline))
+#else
+# define BENCH_NOINLINE
+#endif
+
+static size_t g_alloc_count = 0;
+static size_t g_alloc_bytes = 0;
+
+BENCH_NOINLINE void* operator new(size_t size) BENCH_THROW_BAD_ALLOC {
+	g_alloc_count++;
+	g_alloc_bytes += size;
+	void* res = std::malloc(size ? size : 1);
+	if (res == NULL)
+		throw std::bad_alloc();
+	return (res);
+}
+
+BENCH_NOINLINE void operator delete(void* ptr) throw() {
+	std::free(ptr);
+}
+
+#if __cplusplus >= 201402L
+BENCH_NOINLINE void operator delete(void* ptr, size_t) throw() {
+	std::free(ptr);
+}
+#endif
+
+// 측정 시간을 ns 단위로 반환한다.
+static double elapsed_ns(clock_t start) {
+	return (static_cast<double>(clock() - start) * 1e9 / CLOCKS_PER_SEC);
+}
+
+static void printResult(const char* name, size_t n, double total_ns, size_t ops) {
+	std::cout << name << "\tn: " << n << "\t" << (total_ns / ops) << " ns/op" << std::endl;
+}
+
+// 이전 구현과 같은 방식으로 begin()부터 선형 탐색한다. (비교 기준)
+static MAP::const_iterator scan_lower_bound(const MAP& mp, const T1& k) {
+	MAP::const_iterator it = mp.begin();
+	MAP::const_iterator ite = mp.end();
+	while (it != ite && it->first < k)
+		++it;
+	return (it);
+}
+
+// lower_bound / upper_bound 와 선형 탐색의 비용을 n에 따라 비교한다.
+static void bench_bounds() {
+	std::cout << "===== lower_bound | upper_bound =====" << std::endl;
+	for (size_t n = 1000; n <= 1000000; n *= 10) {
+		MAP mp;
+		for (size_t i = 0; i < n; ++i)
+			mp.insert(TESTED_NAMESPACE::make_pair(static_cast<T1>(i * 2), static_cast<T2>(i)));
+
+		const size_t queries = 1000000;
+		long sink = 0;
+		clock_t start = clock();
+		for (size_t i = 0; i < queries; ++i) {
+			T1 k = static_cast<T1>((i * 7919) % (n * 2));
+			sink += (mp.lower_bound(k) == mp.end());
+			sink += (mp.upper_bound(k) == mp.end());
+		}
+		printResult("bounds", n, elapsed_ns(start), queries);
+
+		const size_t scans = 100;
+		start = clock();
+		for (size_t i = 0; i < scans; ++i) {
+			T1 k = static_cast<T1>((i * 7919) % (n * 2));
+			sink += (scan_lower_bound(mp, k) == mp.end());
+		}
+		printResult("scan", n, elapsed_ns(start), scans);
+		if (sink == 42)
+			std::cout << std::endl;
+	}
+}
+
+// find / count 의 비용을 mapped_type에 따라 비교한다.
+// lookup 경로에서 mapped_type을 만들지 않으므로 std::string도 int와 비슷해야 한다.
+template <typename V>
+static void bench_find(const char* name, const V& val) {
+	const size_t n = 1000000;
+	TESTED_NAMESPACE::map<T1, V> mp;
+	for (size_t i = 0; i < n; ++i)
+		mp.insert(TESTED_NAMESPACE::make_pair(static_cast<T1>(i * 2), val));
+
+	const size_t queries = 2000000;
+	long sink = 0;
+	clock_t start = clock();
+	for (size_t i = 0; i < queries; ++i) {
+		T1 k = static_cast<T1>((i * 7919) % (n * 2));
+		sink += (mp.find(k) == mp.end());
+		sink += mp.count(k + 1);
+	}
+	printResult(name, n, elapsed_ns(start), queries);
+	if (sink == 42)
+		std::cout << std::endl;
+}
+
+// 앞부분이 길게 겹치는 string key로 insert / find 비용을 잰다.
+// key 하나를 비교할 때마다 공통 prefix를 끝까지 읽으므로 노드마다 비교 횟수가 그대로 시간이 된다.
+static void bench_string_keys() {
+	const size_t n = 100000;
+	const std::string prefix(256, 'k');
+	std::vector<std::string> keys;
+	for (size_t i = 0; i < n; ++i) {
+		char buf[16];
+		std::sprintf(buf, "%08lu", static_cast<unsigned long>((i * 7919) % n * 2));
+		keys.push_back(prefix + buf);
+	}
+
+	TESTED_NAMESPACE::map<std::string, T2> mp;
+	clock_t start = clock();
+	for (size_t i = 0; i < n; ++i)
+		mp.insert(TESTED_NAMESPACE::make_pair(keys[i], static_cast<T2>(i)));
+	printResult("insert<string(264),int>", n, elapsed_ns(start), n);
+
+	// 절반은 있는 key, 절반은 없는 key (끝자리만 다르다)
+	const size_t queries = 1000000;
+	long sink = 0;
+	start = clock();
+	for (size_t i = 0; i < queries; ++i) {
+		const std::string& k = keys[i % n];
+		sink += (mp.find(k) == mp.end());
+	}
+	printResult("find hit<string(264),int>", n, elapsed_ns(start), queries);
+
+	for (size_t i = 0; i < n; ++i)
+		keys[i][keys[i].size() - 1] += 1;
+	start = clock();
+	for (size_t i = 0; i < queries; ++i) {
+		const std::string& k = keys[i % n];
+		sink += (mp.find(k) == mp.end());
+	}
+	printResult("find miss<string(264),int>", n, elapsed_ns(start), queries);
+	if (sink == 42)
+		std::cout << std::endl;
+}
+
+// 정렬된 구간 / 섞인 구간으로 range constructor를 호출하는 비용을 잰다.
+static void bench_range() {
+	const size_t n = 1000000;
+	std::vector<MAP::value_type> sorted;
+	std::vector<MAP::value_type> shuffled;
+	for (size_t i = 0; i < n; ++i) {
+		sorted.push_back(MAP::value_type(static_cast<T1>(i), static_cast<T2>(i)));
+		shuffled.push_back(MAP::value_type(static_cast<T1>((i * 7919) % n), static_cast<T2>(i)));
+	}
+
+	clock_t start = clock();
+	MAP mp_sorted(sorted.begin(), sorted.end());
+	printResult("range sorted", n, elapsed_ns(start), n);
+
+	start = clock();
+	MAP mp_shuffled(shuffled.begin(), shuffled.end());
+	printResult("range random", n, elapsed_ns(start), n);
+	if (mp_sorted.size() != mp_shuffled.size())
+		std::cout << "KO" << std::endl;
+}
+
+// hint의 위치에 따라 insert(hint, val)의 비용을 잰다.
+// ascending - 항상 end()에 오름차순으로 삽입
+// descending - 항상 begin()에 내림차순으로 삽입
+// random - 임의의 key를 end()를 hint로 삽입 (맞지 않는 hint)
+// none - 임의의 key를 hint 없이 삽입
+static void bench_hint() {
+	const size_t n = 1000000;
+	{
+		MAP mp;
+		clock_t start = clock();
+		for (size_t i = 0; i < n; ++i)
+			mp.insert(mp.end(), TESTED_NAMESPACE::make_pair(static_cast<T1>(i), static_cast<T2>(i)));
+		printResult("hint ascending", n, elapsed_ns(start), n);
+	}
+	{
+		MAP mp;
+		clock_t start = clock();
+		for (size_t i = n; i > 0; --i)
+			mp.insert(mp.begin(), TESTED_NAMESPACE::make_pair(static_cast<T1>(i), static_cast<T2>(i)));
+		printResult("hint descending", n, elapsed_ns(start), n);
+	}
+	{
+		MAP mp;
+		clock_t start = clock();
+		for (size_t i = 0; i < n; ++i)
+			mp.insert(mp.end(), TESTED_NAMESPACE::make_pair(static_cast<T1>((i * 7919) % n), static_cast<T2>(i)));
+		printResult("hint random", n, elapsed_ns(start), n);
+	}
+	{
+		MAP mp;
+		clock_t start = clock();
+		for (size_t i = 0; i < n; ++i)
+			mp.insert(TESTED_NAMESPACE::make_pair(static_cast<T1>((i * 7919) % n), static_cast<T2>(i)));
+		printResult("hint none", n, elapsed_ns(start), n);
+	}
+}
+
+// 큰 map을 복사 생성 / 대입하는 비용을 잰다.
+static void bench_copy() {
+	const size_t n = 1000000;
+	MAP mp;
+	for (size_t i = 0; i < n; ++i)
+		mp.insert(TESTED_NAMESPACE::make_pair(static_cast<T1>((i * 7919) % n), static_cast<T2>(i)));
+
+	clock_t start = clock();
+	MAP cp(mp);
+	printResult("copy ctor", n, elapsed_ns(start), n);
+
+	MAP as;
+	start = clock();
+	as = cp;
+	printResult("assign", n, elapsed_ns(start), n);
+	if (as.size() != n)
+		std::cout << "KO" << std::endl;
+}
+
+// 95%가 이미 있는 key인 카운팅 작업에서 operator[]의 비용과 할당 횟수를 잰다.
+static void bench_subscript() {
+	const size_t n = 100000;
+	const size_t ops = 2000000;
+	TESTED_NAMESPACE::map<T1, std::string> mp;
+	for (size_t i = 0; i < n; ++i)
+		mp[static_cast<T1>(i)] = "0";
+
+	size_t count = g_alloc_count;
+	clock_t start = clock();
+	for (size_t i = 0; i < ops; ++i) {
+		T1 k = static_cast<T1>((i % 20 == 0) ? n + i : (i * 7919) % n);
+		mp[k][0] += 1;
+	}
+	printResult("operator[]", n, elapsed_ns(start), ops);
+	std::cout << "operator[]\tn: " << n << "\t"
+		<< static_cast<double>(g_alloc_count - count) / ops << " allocs/op" << std::endl;
+}
+
+// 비어있는 map을 만들고 버리는 비용과 할당 횟수, map 객체의 크기를 잰다.
+// 다른 객체의 멤버로 쓰이는 작은 map은 대부분 비어있다.
+static void bench_empty() {
+	const size_t n = 1000000;
+	size_t count = g_alloc_count;
+	long sink = 0;
+	clock_t start = clock();
+	for (size_t i = 0; i < n; ++i) {
+		MAP mp;
+		sink += mp.empty();
+	}
+	printResult("construct/destroy", 0, elapsed_ns(start), n);
+	std::cout << "construct/destroy	n: 0	" << static_cast<double>(g_alloc_count - count) / n << " allocs/map" << std::endl;
+	std::cout << "sizeof(map<int,int>)	" << sizeof(MAP) << " bytes" << std::endl;
+	if (sink == 42)
+		std::cout << std::endl;
+}
+
+// 요소 하나를 넣을 때 발생하는 할당 횟수와 바이트 수를 센다.
+template <typename V>
+static void bench_memory(const char* name, const V& val) {
+	const size_t n = 100000;
+	TESTED_NAMESPACE::map<T1, V> mp;
+	size_t count = g_alloc_count;
+	size_t bytes = g_alloc_bytes;
+	for (size_t i = 0; i < n; ++i)
+		mp.insert(TESTED_NAMESPACE::make_pair(static_cast<T1>(i), val));
+	std::cout << name << "\tn: " << n
+		<< "\t" << static_cast<double>(g_alloc_count - count) / n << " allocs/elem"
+		<< "\t" << static_cast<double>(g_alloc_bytes - bytes) / n << " bytes/elem" << std::endl;
+}
+
+// ft::map 에만 있는 reserve를 호출한다. (std::map은 아무것도 하지 않는다)
+template <typename M>
+static void reserve_nodes(M&, size_t) {}
+
+template <typename K, typename V>
+static void reserve_nodes(ft::map<K, V>& mp, size_t n) {
+	mp.reserve(n);
+}
+
+// 크기가 거의 일정한 map에서 erase / insert 를 반복할 때의 비용과 할당 횟수를 잰다.
+// fill - reserve 후 n개를 채울 때의 할당 횟수
+// churn - 임의의 key 하나를 지우고 새 key 하나를 넣는 것을 반복
+static void bench_churn() {
+	const size_t n = 100000;
+	const size_t ops = 2000000;
+	MAP mp;
+
+	size_t count = g_alloc_count;
+	reserve_nodes(mp, n + 1);
+	for (size_t i = 0; i < n; ++i)
+		mp.insert(TESTED_NAMESPACE::make_pair(static_cast<T1>(i * 2), static_cast<T2>(i)));
+	std::cout << "fill\tn: " << n << "\t" << g_alloc_count - count << " allocs" << std::endl;
+
+	count = g_alloc_count;
+	clock_t start = clock();
+	for (size_t i = 0; i < ops; ++i) {
+		mp.erase(static_cast<T1>(((i * 7919) % n) * 2));
+		mp.insert(TESTED_NAMESPACE::make_pair(static_cast<T1>(((i * 7919) % n) * 2), static_cast<T2>(i)));
+	}
+	printResult("churn", n, elapsed_ns(start), ops);
+	std::cout << "churn\tn: " << n << "\t" << static_cast<double>(g_alloc_count - count) / ops << " allocs/op" << std::endl;
+}
+
+// 같은 key가 많이 겹치는 multimap (보조 인덱스)의 insert, equal_range, count, erase(key) 비용을 잰다.
+// key마다 n / keys 개의 요소가 있다.
+static void bench_multimap() {
+	const size_t n = 1000000;
+	for (size_t keys = 1000; keys <= 100000; keys *= 100) {
+		TESTED_NAMESPACE::multimap<T1, T2> mp;
+		clock_t start = clock();
+		for (size_t i = 0; i < n; ++i)
+			mp.insert(TESTED_NAMESPACE::make_pair(static_cast<T1>((i * 7919) % keys), static_cast<T2>(i)));
+		printResult("multimap insert", keys, elapsed_ns(start), n);
+
+		const size_t queries = 1000000;
+		long sink = 0;
+		start = clock();
+		for (size_t i = 0; i < queries; ++i)
+			sink += mp.equal_range(static_cast<T1>((i * 7919) % keys)).first->second;
+		printResult("multimap equal_range", keys, elapsed_ns(start), queries);
+
+		start = clock();
+		for (size_t i = 0; i < keys; ++i)
+			sink += mp.count(static_cast<T1>(i));
+		printResult("multimap count", keys, elapsed_ns(start), keys);
+
+		// 지운 요소 하나당 비용
+		start = clock();
+		for (size_t i = 0; i < keys; ++i)
+			sink += mp.erase(static_cast<T1>(i));
+		printResult("multimap erase(key) per elem", keys, elapsed_ns(start), n);
+		if (sink == 42 || !mp.empty())
+			std::cout << std::endl;
+	}
+}
+
+// ft::map이면 서브트리 크기를 저장하는 map, std::map이면 그대로 쓴다.
+template <typename M>
+struct with_size_augment {
+	typedef M type;
+};
+
+template <typename K, typename V, typename C, typename A>
+struct with_size_augment< ft::map<K, V, C, A> > {
+	typedef ft::map<K, V, C, A, ft::rb_size_augment> type;
+};
+
+// i번째 요소 / k보다 작은 요소의 개수 / [lo, hi) 구간의 요소 개수
+// std::map은 iterator를 하나씩 옮겨 구하고, 크기를 저장하는 ft::map은 O(log n)에 구한다.
+template <typename M>
+static typename M::const_iterator get_nth(const M& mp, size_t i) {
+	typename M::const_iterator it = mp.begin();
+	std::advance(it, i);
+	return (it);
+}
+
+template <typename K, typename V, typename C, typename A>
+static typename ft::map<K, V, C, A, ft::rb_size_augment>::const_iterator get_nth(const ft::map<K, V, C, A, ft::rb_size_augment>& mp, size_t i) {
+	return (mp.nth(i));
+}
+
+template <typename M>
+static size_t get_rank(const M& mp, const typename M::key_type& k) {
+	return (std::distance(mp.begin(), mp.lower_bound(k)));
+}
+
+template <typename K, typename V, typename C, typename A>
+static size_t get_rank(const ft::map<K, V, C, A, ft::rb_size_augment>& mp, const K& k) {
+	return (mp.rank(k));
+}
+
+template <typename M>
+static size_t get_range_count(const M& mp, const typename M::key_type& lo, const typename M::key_type& hi) {
+	return (std::distance(mp.lower_bound(lo), mp.lower_bound(hi)));
+}
+
+template <typename K, typename V, typename C, typename A>
+static size_t get_range_count(const ft::map<K, V, C, A, ft::rb_size_augment>& mp, const K& lo, const K& hi) {
+	return (mp.aggregate(lo, hi));
+}
+
+// 서브트리 크기를 저장할 때 insert / erase가 얼마나 느려지는지와 nth, rank, 구간 개수를 구하는 비용을 잰다.
+static void bench_order_statistics() {
+	typedef with_size_augment<MAP>::type order_map;
+	const size_t n = 100000;
+	order_map mp;
+	clock_t start = clock();
+	for (size_t i = 0; i < n; ++i)
+		mp.insert(TESTED_NAMESPACE::make_pair(static_cast<T1>((i * 7919) % n), static_cast<T2>(i)));
+	printResult("insert random", n, elapsed_ns(start), n);
+
+	const size_t queries = 2000;
+	long sink = 0;
+	start = clock();
+	for (size_t i = 0; i < queries; ++i)
+		sink += get_nth(mp, (i * 7919) % n)->second;
+	printResult("nth", n, elapsed_ns(start), queries);
+
+	start = clock();
+	for (size_t i = 0; i < queries; ++i)
+		sink += get_rank(mp, static_cast<T1>((i * 7919) % n));
+	printResult("rank", n, elapsed_ns(start), queries);
+
+	start = clock();
+	for (size_t i = 0; i < queries; ++i)
+		sink += get_range_count(mp, static_cast<T1>((i * 7919) % (n / 2)), static_cast<T1>((i * 7919) % (n / 2) + n / 2));
+	printResult("count in [lo, hi)", n, elapsed_ns(start), queries);
+
+	start = clock();
+	for (size_t i = 0; i < n; ++i)
+		sink += mp.erase(static_cast<T1>((i * 7919) % n));
+	printResult("erase random", n, elapsed_ns(start), n);
+	if (sink == 42 || !mp.empty())
+		std::cout << std::endl;
+}
+
+// ft::map은 split / join으로 tree를 자르고 붙인다. std::map은 옮길 요소를 하나씩 insert / erase 한다.
+template <typename M>
+static void split_map(M& mp, const typename M::key_type& k, M& other) {
+	other.clear();
+	other.insert(mp.lower_bound(k), mp.end());
+	mp.erase(mp.lower_bound(k), mp.end());
+}
+
+template <typename K, typename V, typename C, typename A, typename G>
+static void split_map(ft::map<K, V, C, A, G>& mp, const K& k, ft::map<K, V, C, A, G>& other) {
+	mp.split(k, other);
+}
+
+template <typename M>
+static void join_map(M& mp, M& other) {
+	mp.insert(other.begin(), other.end());
+	other.clear();
+}
+
+template <typename K, typename V, typename C, typename A, typename G>
+static void join_map(ft::map<K, V, C, A, G>& mp, ft::map<K, V, C, A, G>& other) {
+	mp.join(other);
+}
+
+// 10^6개의 map을 임의의 key에서 둘로 나눈 뒤 다시 붙이는 비용을 잰다. (shard 분할 / 병합)
+// 서브트리 크기가 없으면 ft::map도 나눈 뒤 작은 쪽의 개수를 센다.
+template <typename M>
+static void bench_split_join(const char* name) {
+	const size_t n = 1000000;
+	M mp;
+	M other;
+	for (size_t i = 0; i < n; ++i)
+		mp.insert(mp.end(), TESTED_NAMESPACE::make_pair(static_cast<T1>(i), static_cast<T2>(i)));
+
+	// 0.2초가 지날 때까지 반복한다. (요소를 하나씩 옮기면 몇 번 돌지 못한다)
+	size_t rounds = 0;
+	clock_t start = clock();
+	while (rounds < 100000 && clock() - start < CLOCKS_PER_SEC / 5) {
+		split_map(mp, static_cast<T1>((rounds * 7919) % n), other);
+		join_map(mp, other);
+		rounds++;
+	}
+	printResult(name, n, elapsed_ns(start), rounds);
+	if (mp.size() != n || !other.empty())
+		std::cout << "KO" << std::endl;
+}
+
+// 10^7개의 요소를 가진 map을 소멸시키는 비용을 잰다. (노드 하나당 ns)
+// sorted - 오름차순으로 넣어 tree 순서와 메모리 순서가 거의 같은 경우
+// random - 섞인 순서로 넣어 tree 순서로 훑으면 메모리를 건너뛰는 경우
+static void bench_destroy() {
+	const size_t n = 10000000;
+	for (int random = 0; random < 2; ++random) {
+		MAP* mp = new MAP;
+		for (size_t i = 0; i < n; ++i) {
+			if (random)
+				mp->insert(TESTED_NAMESPACE::make_pair(static_cast<T1>((i * 7919) % n), static_cast<T2>(i)));
+			else
+				mp->insert(mp->end(), TESTED_NAMESPACE::make_pair(static_cast<T1>(i), static_cast<T2>(i)));
+		}
+		clock_t start = clock();
+		delete mp;
+		printResult(random ? "destroy random" : "destroy sorted", n, elapsed_ns(start), n);
+	}
+}
+
+// map 전체를 iterator로 앞에서부터 / 뒤에서부터 훑는 비용을 잰다.
+// 캐시에 들어가는 크기와 들어가지 않는 크기를 모두 잰다.
+// 노드가 작을수록, ++/--가 자식 노드를 읽지 않고 nil을 판단할수록 빨라진다.
+static void bench_iterate() {
+	for (size_t n = 1000; n <= 1000000; n *= 1000) {
+		const size_t rounds = 20000000 / n;
+		MAP mp;
+		for (size_t i = 0; i < n; ++i)
+			mp.insert(TESTED_NAMESPACE::make_pair(static_cast<T1>((i * 7919) % n), static_cast<T2>(i)));
+		long sink = 0;
+
+		clock_t start = clock();
+		for (size_t r = 0; r < rounds; ++r) {
+			for (MAP::const_iterator it = mp.begin(); it != mp.end(); ++it)
+				sink += it->second;
+		}
+		printResult("forward", n, elapsed_ns(start), n * rounds);
+
+		start = clock();
+		for (size_t r = 0; r < rounds; ++r) {
+			for (MAP::const_reverse_iterator it = mp.rbegin(); it != mp.rend(); ++it)
+				sink += it->second;
+		}
+		printResult("backward", n, elapsed_ns(start), n * rounds);
+		if (sink == 42)
+			std::cout << std::endl;
+	}
+}
+
+// 요청마다 임시 map을 만들고 버리는 작업에서 std::allocator와 arena_allocator를 비교한다.
+// arena는 scope가 끝날 때 노드를 하나씩 해제하지 않고 한 번에 되돌린다.
+static void bench_arena() {
+	typedef TESTED_NAMESPACE::pair<const T1, T2> value_type;
+	typedef TESTED_NAMESPACE::map<T1, T2, TESTED_NAMESPACE::less<T1>, ft::arena_allocator<value_type> > arena_map;
+	const size_t n = 1000;
+	const size_t requests = 2000;
+
+	clock_t start = clock();
+	for (size_t r = 0; r < requests; ++r) {
+		MAP mp;
+		for (size_t i = 0; i < n; ++i)
+			mp.insert(TESTED_NAMESPACE::make_pair(static_cast<T1>((i * 7919) % n), static_cast<T2>(r)));
+	}
+	printResult("std::allocator", n, elapsed_ns(start), requests);
+
+	ft::arena arena;
+	size_t count = g_alloc_count;
+	start = clock();
+	for (size_t r = 0; r < requests; ++r) {
+		ft::arena::scope scope(arena);
+		arena_map mp(TESTED_NAMESPACE::less<T1>(), arena);
+		for (size_t i = 0; i < n; ++i)
+			mp.insert(TESTED_NAMESPACE::make_pair(static_cast<T1>((i * 7919) % n), static_cast<T2>(r)));
+	}
+	printResult("arena_allocator", n, elapsed_ns(start), requests);
+	std::cout << "arena_allocator\tn: " << n << "\t"
+		<< static_cast<double>(g_alloc_count - count) / requests << " allocs/request" << std::endl;
+}
+
+int main() {
+	std::cout << "################ Bench Map ################" << std::endl;
+	bench_bounds();
+	std::cout << "===== find | count =====" << std::endl;
+	bench_find<int>("find<int,int>", 0);
+	bench_find<std::string>("find<int,string>", std::string(64, 'x'));
+	std::cout << "===== long common-prefix string keys =====" << std::endl;
+	bench_string_keys();
+	std::cout << "===== range constructor =====" << std::endl;
+	bench_range();
+	std::cout << "===== insert with hint =====" << std::endl;
+	bench_hint();
+	std::cout << "===== copy =====" << std::endl;
+	bench_copy();
+	std::cout << "===== operator[] (95% hit) =====" << std::endl;
+	bench_subscript();
+	std::cout << "===== iterate =====" << std::endl;
+	bench_iterate();
+	std::cout << "===== erase / insert churn =====" << std::endl;
+	bench_churn();
+	std::cout << "===== multimap (n: key count) =====" << std::endl;
+	bench_multimap();
+	std::cout << "===== order statistics =====" << std::endl;
+	bench_order_statistics();
+	std::cout << "===== split | join =====" << std::endl;
+	bench_split_join<MAP>("split + join");
+	bench_split_join<with_size_augment<MAP>::type>("split + join (size augment)");
+	std::cout << "===== destroy =====" << std::endl;
+	bench_destroy();
+	std::cout << "===== scratch map per request =====" << std::endl;
+	bench_arena();
+	std::cout << "===== empty map =====" << std::endl;
+	bench_empty();
+	std::cout << "===== memory =====" << std::endl;
+	bench_memory<int>("memory<int,int>", 0);
+	bench_memory<std::string>("memory<int,string>", std::string(64, 'x'));
+}
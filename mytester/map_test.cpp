@@ -1,5 +1,7 @@
 #include "map.hpp"
+#include "arena_allocator.hpp"
 #include <iostream>
+#include <sstream>
 #include <string>
 #include <list>
 #include <map>
@@ -8,6 +10,24 @@
 #define TESTED_NAMESPACE ft
 #endif
 
+#if __cplusplus >= 201103L
+// 복사할 수 없고 옮기면 원래 값이 -1이 되는 타입 (move / emplace 경로 확인)
+struct MoveOnly {
+	int value;
+
+	MoveOnly(int v = 0) : value(v) {}
+	MoveOnly(const MoveOnly&) = delete;
+	MoveOnly& operator=(const MoveOnly&) = delete;
+	MoveOnly(MoveOnly&& x) noexcept : value(x.value) { x.value = -1; }
+	MoveOnly& operator=(MoveOnly&& x) noexcept {
+		value = x.value;
+		x.value = -1;
+		return (*this);
+	}
+	bool operator<(const MoveOnly& x) const { return (value < x.value); }
+};
+#endif
+
 #define T1 int
 #define T2 std::string
 #define T3 TESTED_NAMESPACE::map<T1, T2>::value_type
@@ -28,6 +48,368 @@ void printContainers(T const &mp, bool print_content = true) {
 	std::cout << "------------------------" << std::endl;
 }
 
+// 복사 / 생성될 때마다 개수를 센다.
+struct Counted {
+	static int constructed;
+	int value;
+
+	Counted(int v = 0) : value(v) { constructed++; }
+	Counted(const Counted& x) : value(x.value) { constructed++; }
+	Counted& operator=(const Counted& x) {
+		value = x.value;
+		return (*this);
+	}
+};
+int Counted::constructed = 0;
+
+// 할당 횟수와 아직 해제되지 않은 객체 수를 센다. (rebind된 allocator도 같이 센다)
+struct AllocCount {
+	static long allocs;
+	static long live;
+};
+long AllocCount::allocs = 0;
+long AllocCount::live = 0;
+
+template <typename T>
+struct CountingAlloc : public std::allocator<T> {
+	template <typename U>
+	struct rebind {
+		typedef CountingAlloc<U> other;
+	};
+
+	CountingAlloc() {}
+	template <typename U>
+	CountingAlloc(const CountingAlloc<U>&) {}
+
+	T* allocate(std::size_t n, const void* = 0) {
+		AllocCount::allocs++;
+		AllocCount::live += n;
+		return (std::allocator<T>::allocate(n));
+	}
+	void deallocate(T* p, std::size_t n) {
+		AllocCount::live -= n;
+		std::allocator<T>::deallocate(p, n);
+	}
+};
+
+template <typename T, typename U>
+bool operator==(const CountingAlloc<T>&, const CountingAlloc<U>&) { return (true); }
+template <typename T, typename U>
+bool operator!=(const CountingAlloc<T>&, const CountingAlloc<U>&) { return (false); }
+
+// reserve는 ft::map의 확장이다. std는 아무것도 하지 않고 false를 반환한다. -> 할당 횟수는 ft에서만 확인한다.
+template <typename M>
+bool reserve_nodes(M&, std::size_t) {
+	return (false);
+}
+
+template <typename K, typename V, typename C, typename A, typename G>
+bool reserve_nodes(ft::map<K, V, C, A, G>& mp, std::size_t n) {
+	mp.reserve(n);
+	return (true);
+}
+
+template <typename M>
+void printCounted(const M& mp) {
+	std::cout << "size: " << mp.size() << "\tkeys:";
+	for (typename M::const_iterator it = mp.begin(); it != mp.end(); ++it)
+		std::cout << " " << it->first;
+	std::cout << std::endl;
+}
+
+// nth / rank / distance / aggregate / refresh는 Augment를 준 ft::map의 확장이다.
+// std는 iterator를 하나씩 옮기거나 구간을 직접 합쳐 같은 값을 만든다.
+template <typename M, typename Monoid>
+struct with_augment {
+	typedef M type;
+};
+
+template <typename K, typename V, typename C, typename A>
+struct with_augment<ft::map<K, V, C, A>, void> {
+	typedef ft::map<K, V, C, A, ft::rb_size_augment> type;
+};
+
+template <typename K, typename V, typename C, typename A, typename Monoid>
+struct with_augment<ft::map<K, V, C, A>, Monoid> {
+	typedef ft::map<K, V, C, A, ft::rb_monoid_augment<Monoid> > type;
+};
+
+// 요소 개수 (rb_size_augment의 aggregate)
+struct count_monoid {
+	typedef std::size_t result_type;
+
+	result_type identity() const { return (0); }
+	template <typename T>
+	result_type lift(const T&) const { return (1); }
+	result_type combine(const result_type& a, const result_type& b) const { return (a + b); }
+};
+
+// key를 순서대로 이어 붙인다. -> 교환법칙이 없으므로 합치는 순서가 틀리면 결과가 달라진다.
+struct key_list_monoid {
+	typedef std::string result_type;
+
+	result_type identity() const { return (""); }
+	template <typename T>
+	result_type lift(const T& value) const {
+		std::ostringstream oss;
+		oss << value.first << ",";
+		return (oss.str());
+	}
+	result_type combine(const result_type& a, const result_type& b) const { return (a + b); }
+};
+
+// first에서 last까지 iterator를 하나씩 옮긴 횟수
+template <typename Iterator>
+long count_steps(Iterator first, Iterator last) {
+	long n = 0;
+	for (; first != last; ++first)
+		n++;
+	return (n);
+}
+
+// key가 [lo, hi)인 요소를 하나씩 합친다. (lo <= hi)
+template <typename M, typename Monoid>
+typename Monoid::result_type fold_range(const M& mp, const typename M::key_type& lo, const typename M::key_type& hi, const Monoid& monoid) {
+	typename Monoid::result_type res = monoid.identity();
+	typename M::const_iterator last = mp.lower_bound(hi);
+	for (typename M::const_iterator it = mp.lower_bound(lo); it != last; ++it)
+		res = monoid.combine(res, monoid.lift(*it));
+	return (res);
+}
+
+template <typename M>
+typename M::const_iterator get_nth(const M& mp, std::size_t i) {
+	if (i >= mp.size())
+		return (mp.end());
+	typename M::const_iterator it = mp.begin();
+	while (i-- > 0)
+		++it;
+	return (it);
+}
+
+template <typename K, typename V, typename C, typename A, typename G>
+typename ft::map<K, V, C, A, G>::const_iterator get_nth(const ft::map<K, V, C, A, G>& mp, std::size_t i) {
+	return (mp.nth(i));
+}
+
+template <typename M>
+std::size_t get_rank(const M& mp, const typename M::key_type& k) {
+	return (count_steps(mp.begin(), mp.lower_bound(k)));
+}
+
+template <typename K, typename V, typename C, typename A, typename G>
+std::size_t get_rank(const ft::map<K, V, C, A, G>& mp, const K& k) {
+	return (mp.rank(k));
+}
+
+template <typename M>
+long get_distance(const M&, typename M::const_iterator first, typename M::const_iterator last) {
+	return (count_steps(first, last));
+}
+
+template <typename K, typename V, typename C, typename A, typename G>
+long get_distance(const ft::map<K, V, C, A, G>& mp, typename ft::map<K, V, C, A, G>::const_iterator first, typename ft::map<K, V, C, A, G>::const_iterator last) {
+	return (mp.distance(first, last));
+}
+
+template <typename M, typename Monoid>
+typename Monoid::result_type get_aggregate(const M& mp, const typename M::key_type& lo, const typename M::key_type& hi, const Monoid& monoid) {
+	return (fold_range(mp, lo, hi, monoid));
+}
+
+template <typename K, typename V, typename C, typename A, typename G, typename Monoid>
+typename ft::map<K, V, C, A, G>::aggregate_type get_aggregate(const ft::map<K, V, C, A, G>& mp, const K& lo, const K& hi, const Monoid&) {
+	return (mp.aggregate(lo, hi));
+}
+
+template <typename M>
+void refresh_value(M&, typename M::iterator) {}
+
+template <typename K, typename V, typename C, typename A, typename G>
+void refresh_value(ft::map<K, V, C, A, G>& mp, typename ft::map<K, V, C, A, G>::iterator position) {
+	mp.refresh(position);
+}
+
+// nth, rank, distance, aggregate를 iterator를 하나씩 옮겨 구한 값과 모두 비교한다.
+// (ft의 iterator는 ft의 iterator tag를 쓰므로 std::advance / std::distance 대신 직접 센다)
+template <typename M, typename Monoid>
+bool check_order_statistics(const M& mp, const Monoid& monoid) {
+	bool ok = true;
+	typename M::const_iterator it = mp.begin();
+	for (std::size_t i = 0; i <= mp.size(); ++i, ++it) {
+		if (get_nth(mp, i) != it)
+			ok = false;
+		if (i == mp.size())
+			break ;
+	}
+	if (get_nth(mp, mp.size() + 3) != mp.end())
+		ok = false;
+	for (int k = -1; k <= 201; ++k) {
+		if (get_rank(mp, k) != static_cast<std::size_t>(count_steps(mp.begin(), mp.lower_bound(k))))
+			ok = false;
+	}
+	for (int lo = -1; lo <= 201; lo += 7) {
+		for (int hi = lo; hi <= 202; hi += 11) {
+			typename M::const_iterator first = mp.lower_bound(lo);
+			typename M::const_iterator last = mp.lower_bound(hi);
+			if (get_distance(mp, first, last) != count_steps(first, last))
+				ok = false;
+			if (get_aggregate(mp, lo, hi, monoid) != fold_range(mp, lo, hi, monoid))
+				ok = false;
+		}
+	}
+	return (ok);
+}
+
+// split / join은 ft::map의 확장이다.
+// std는 옮길 구간을 insert / erase 한다. join에서 이미 있는 key는 ft와 같이 other에 남긴다.
+template <typename M>
+void split_into(M& mp, const typename M::key_type& k, M& other) {
+	other.clear();
+	other.insert(mp.lower_bound(k), mp.end());
+	mp.erase(mp.lower_bound(k), mp.end());
+}
+
+template <typename K, typename V, typename C, typename A, typename G>
+void split_into(ft::map<K, V, C, A, G>& mp, const K& k, ft::map<K, V, C, A, G>& other) {
+	mp.split(k, other);
+}
+
+template <typename M>
+void join_from(M& mp, M& other) {
+	typename M::iterator it = other.begin();
+	while (it != other.end()) {
+		if (mp.insert(*it).second)
+			other.erase(it++);
+		else
+			++it;
+	}
+}
+
+template <typename K, typename V, typename C, typename A, typename G>
+void join_from(ft::map<K, V, C, A, G>& mp, ft::map<K, V, C, A, G>& other) {
+	mp.join(other);
+}
+
+// 서브트리 크기를 저장하는 map은 split / join 뒤에도 nth, rank가 맞아야 한다.
+template <typename M>
+bool order_ok(const M&) {
+	return (true);
+}
+
+template <typename K, typename V, typename C, typename A>
+bool order_ok(const ft::map<K, V, C, A, ft::rb_size_augment>& mp) {
+	return (check_order_statistics(mp, count_monoid()));
+}
+
+// 앞 / 뒤로 훑은 개수가 size()와 같고 key가 증가하는지 확인한 뒤 key를 출력한다.
+template <typename M>
+void printSplit(const char* name, const M& mp) {
+	bool ok = order_ok(mp);
+	std::size_t n = 0;
+	for (typename M::const_iterator it = mp.begin(); it != mp.end(); ++it, ++n) {
+		typename M::const_iterator next = it;
+		if (++next != mp.end() && !(it->first < next->first))
+			ok = false;
+	}
+	if (n != mp.size() || static_cast<std::size_t>(count_steps(mp.rbegin(), mp.rend())) != n)
+		ok = false;
+	std::cout << name << "\tsize: " << mp.size() << "\tvalid: " << (ok ? "OK" : "KO") << "\tkeys:";
+	for (typename M::const_iterator it = mp.begin(); it != mp.end(); ++it)
+		std::cout << " " << it->first;
+	std::cout << std::endl;
+}
+
+// key 0, 3, ..., 57을 가진 mp를 여러 위치에서 나누고 양쪽 방향으로 다시 붙인다.
+template <typename M>
+void test_split_join(M& mp, M& other) {
+	for (int i = 0; i < 20; ++i)
+		mp.insert(mp.end(), typename M::value_type(i * 3, i * 30));
+	other.insert(typename M::value_type(1000, 1000));
+
+	split_into(mp, -5, other);
+	std::cout << "split below min" << std::endl;
+	printSplit("left", mp);
+	printSplit("right", other);
+	join_from(mp, other);
+	std::cout << "join into empty" << std::endl;
+	printSplit("left", mp);
+	printSplit("right", other);
+
+	split_into(mp, 100, other);
+	std::cout << "split above max" << std::endl;
+	printSplit("left", mp);
+	printSplit("right", other);
+	join_from(mp, other);
+	std::cout << "join empty" << std::endl;
+	printSplit("left", mp);
+
+	split_into(mp, 30, other);
+	std::cout << "split at existing key" << std::endl;
+	printSplit("left", mp);
+	printSplit("right", other);
+	join_from(other, mp);
+	std::cout << "join smaller keys (prepend)" << std::endl;
+	printSplit("left", mp);
+	printSplit("right", other);
+	join_from(mp, other);
+
+	split_into(mp, 31, other);
+	std::cout << "split at missing key" << std::endl;
+	printSplit("left", mp);
+	printSplit("right", other);
+	join_from(mp, other);
+	std::cout << "join greater keys (append)" << std::endl;
+	printSplit("left", mp);
+
+	// 세 조각으로 나눈 뒤 떨어진 조각을 먼저 붙이고, 사이에 들어가는 조각은 겹치는 범위로 붙인다.
+	M middle(mp);
+	split_into(mp, 40, middle);
+	M last(mp);
+	split_into(middle, 50, last);
+	join_from(mp, last);
+	join_from(mp, middle);
+	std::cout << "join overlapping range" << std::endl;
+	printSplit("left", mp);
+	printSplit("middle", middle);
+	printSplit("last", last);
+
+	// 양쪽에 있는 key(3)는 그대로 두고 other에 남는다.
+	other.clear();
+	other.insert(typename M::value_type(3, -1));
+	other.insert(typename M::value_type(4, -1));
+	other.insert(typename M::value_type(100, -1));
+	join_from(mp, other);
+	std::cout << "join with duplicate key" << std::endl;
+	printSplit("left", mp);
+	printSplit("right", other);
+	std::cout << "kept value: " << mp.find(3)->second << "\tleft in other: " << other.find(3)->second << std::endl;
+
+	mp.erase(57);
+	mp.insert(typename M::value_type(58, 580));
+	split_into(mp, 20, other);
+	other.erase(other.begin());
+	other.insert(typename M::value_type(2000, 1));
+	std::cout << "edit after split" << std::endl;
+	printSplit("left", mp);
+	printSplit("right", other);
+}
+
+// try_emplace는 ft::map의 확장이다. (std::map은 c++17부터)
+// std는 lower_bound + hint insert로 같은 결과를 만든다.
+template <typename M>
+TESTED_NAMESPACE::pair<typename M::iterator, bool> get_try_emplace(M& mp, const typename M::key_type& k, const typename M::mapped_type& obj) {
+	typename M::iterator it = mp.lower_bound(k);
+	if (it != mp.end() && !mp.key_comp()(k, it->first))
+		return (TESTED_NAMESPACE::make_pair(it, false));
+	return (TESTED_NAMESPACE::make_pair(mp.insert(it, typename M::value_type(k, obj)), true));
+}
+
+template <typename K, typename V, typename C, typename A, typename G>
+ft::pair<typename ft::map<K, V, C, A, G>::iterator, bool> get_try_emplace(ft::map<K, V, C, A, G>& mp, const K& k, const V& obj) {
+	return (mp.try_emplace(k, obj));
+}
+
 int main() {
 	std::cout << "################ Test Map ################" << std::endl;
 	std::cout << "===== default | range | copy constructor =====" << std::endl;
@@ -148,4 +530,254 @@ int main() {
 	std::cout << "operator<=: " << ((lhs <= rhs) ? "OK" : "KO") << std::endl;
 	std::cout << "operator>:  " << ((lhs > rhs) ? "OK" : "KO") << std::endl;
 	std::cout << "operator>=: " << ((lhs >= rhs) ? "OK" : "KO") << std::endl;
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== try_emplace =====" << std::endl;
+	TESTED_NAMESPACE::map<T1, Counted> mp_try;
+	mp_try[1] = Counted(10);
+	mp_try[3] = Counted(30);
+
+	Counted::constructed = 0;
+	TESTED_NAMESPACE::pair<TESTED_NAMESPACE::map<T1, Counted>::iterator, bool> try_res = get_try_emplace(mp_try, 3, Counted(99));
+	std::cout << "existing key: " << try_res.first->first << " -> " << try_res.first->second.value
+		<< "\tinserted: " << (try_res.second ? "true" : "false") << std::endl;
+	std::cout << "mapped constructed on hit: " << (Counted::constructed - 1) << std::endl;
+
+	try_res = get_try_emplace(mp_try, 2, Counted(20));
+	std::cout << "new key: " << try_res.first->first << " -> " << try_res.first->second.value
+		<< "\tinserted: " << (try_res.second ? "true" : "false") << std::endl;
+	std::cout << "iterator points to new element: " << ((try_res.first == mp_try.find(2)) ? "OK" : "KO") << std::endl;
+	std::cout << "size: " << mp_try.size() << std::endl;
+	for (TESTED_NAMESPACE::map<T1, Counted>::iterator it = mp_try.begin(); it != mp_try.end(); ++it)
+		std::cout << "- key: " << it->first << "\t& value: " << it->second.value << std::endl;
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== reserve | node reuse =====" << std::endl;
+	{
+		typedef TESTED_NAMESPACE::map<T1, T2, TESTED_NAMESPACE::less<T1>, CountingAlloc<T3> > counted_map;
+		long allocs;
+
+		// 지운 노드는 재사용하지만, 줄어든 map은 사용 중인 노드의 두 배 넘게 갖지 않고 clear하면 모두 해제한다.
+		counted_map mp_churn;
+		for (int i = 0; i < 64; ++i)
+			mp_churn[i] = "churn";
+		allocs = AllocCount::allocs;
+		for (int i = 0; i < 256; ++i) {
+			mp_churn.erase(i);
+			mp_churn[i + 64] = "churn";
+		}
+		std::cout << "churn reuses erased nodes: " << ((AllocCount::allocs - allocs <= 1 || !reserve_nodes(mp_churn, 0)) ? "OK" : "KO") << std::endl;
+		mp_churn.erase(mp_churn.begin(), mp_churn.find(312));
+		printCounted(mp_churn);
+		std::cout << "shrunk map keeps at most twice its nodes: " << ((AllocCount::live <= 2 * 8 + 1) ? "OK" : "KO") << std::endl;
+		mp_churn.clear();
+		std::cout << "clear releases every node: " << ((AllocCount::live == 0) ? "OK" : "KO") << std::endl;
+
+		// reserve한 노드는 clear 후에도 남아 있어 다시 넣을 때 할당하지 않는다.
+		counted_map mp_reserve;
+		bool reserved = reserve_nodes(mp_reserve, 32);
+		allocs = AllocCount::allocs;
+		for (int i = 0; i < 32; ++i)
+			mp_reserve[i * 2] = "reserved";
+		for (int i = 0; i < 32; i += 2)
+			mp_reserve.erase(i * 2);
+		for (int i = 0; i < 16; ++i)
+			mp_reserve[i * 2 + 1] = "reused";
+		printCounted(mp_reserve);
+		std::cout << "no allocation within reserve: " << ((!reserved || AllocCount::allocs == allocs) ? "OK" : "KO") << std::endl;
+
+		counted_map mp_copy(mp_reserve);
+		counted_map mp_other;
+		mp_other[100] = "other";
+		mp_other.swap(mp_reserve);
+		std::cout << "copy of reserved map: " << ((mp_copy == mp_other) ? "OK" : "KO") << std::endl;
+		std::cout << "after swap: " << std::endl;
+		printCounted(mp_reserve);
+		printCounted(mp_other);
+		allocs = AllocCount::allocs;
+		mp_other.clear();
+		for (int i = 0; i < 32; ++i)
+			mp_other[i] = "again";
+		printCounted(mp_other);
+		std::cout << "swapped slab reused after clear: " << ((!reserved || AllocCount::allocs == allocs) ? "OK" : "KO") << std::endl;
+		mp_copy.clear();
+		mp_reserve.clear();
+		std::cout << "only reserved nodes kept: " << ((!reserved || AllocCount::live == 32 + 1 + 1) ? "OK" : "KO") << std::endl;
+	}
+	std::cout << "all nodes released: " << ((AllocCount::live == 0) ? "OK" : "KO") << std::endl;
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== order statistics | aggregate =====" << std::endl;
+	{
+		typedef TESTED_NAMESPACE::map<int, long> base_map;
+		typedef ft::sum_monoid< long, ft::select2nd< TESTED_NAMESPACE::pair<const int, long> > > sum_type;
+		typedef with_augment<base_map, void>::type order_map;
+		typedef with_augment<base_map, sum_type>::type sum_map;
+		typedef with_augment<base_map, key_list_monoid>::type list_map;
+		order_map mp_order;
+		sum_map mp_sum;
+		list_map mp_list;
+
+		// 같은 순서로 무작위 insert / erase를 한 뒤 iterator로 구한 값과 비교한다.
+		unsigned long seed = 42;
+		for (int i = 0; i < 800; ++i) {
+			seed = (seed * 1103515245 + 12345) % 2147483648UL;
+			int k = static_cast<int>((seed >> 8) % 200);
+			if (i % 97 == 96) {
+				mp_order.erase(mp_order.lower_bound(k), mp_order.lower_bound(k + 6));
+				mp_sum.erase(mp_sum.lower_bound(k), mp_sum.lower_bound(k + 6));
+				mp_list.erase(mp_list.lower_bound(k), mp_list.lower_bound(k + 6));
+			}
+			else if ((seed >> 4) % 3 == 0) {
+				mp_order.erase(k);
+				mp_sum.erase(k);
+				mp_list.erase(k);
+			}
+			else {
+				mp_order.insert(TESTED_NAMESPACE::make_pair(k, k * 3L - 100));
+				mp_sum.insert(TESTED_NAMESPACE::make_pair(k, k * 3L - 100));
+				mp_list.insert(TESTED_NAMESPACE::make_pair(k, k * 3L - 100));
+			}
+			if (i % 200 == 199) {
+				std::cout << "size: " << mp_order.size();
+				std::cout << "\tsize augment: " << (check_order_statistics(mp_order, count_monoid()) ? "OK" : "KO");
+				std::cout << "\tsum monoid: " << (check_order_statistics(mp_sum, sum_type()) ? "OK" : "KO");
+				std::cout << "\tkey list monoid: " << (check_order_statistics(mp_list, key_list_monoid()) ? "OK" : "KO") << std::endl;
+			}
+		}
+		std::cout << "nth 0: " << get_nth(mp_order, 0)->first << "\tnth mid: " << get_nth(mp_order, mp_order.size() / 2)->first << std::endl;
+		std::cout << "rank 100: " << get_rank(mp_order, 100) << "\tdistance: " << get_distance(mp_order, mp_order.begin(), mp_order.end()) << std::endl;
+		std::cout << "count [50, 150): " << get_aggregate(mp_order, 50, 150, count_monoid()) << std::endl;
+		std::cout << "sum [50, 150): " << get_aggregate(mp_sum, 50, 150, sum_type()) << std::endl;
+		std::cout << "sum [150, 150): " << get_aggregate(mp_sum, 150, 150, sum_type()) << std::endl;
+		std::cout << "keys [20, 60): " << get_aggregate(mp_list, 20, 60, key_list_monoid()) << std::endl;
+
+		// mapped 값을 바꾼 뒤 refresh로 합을 다시 맞춘다.
+		int n = 0;
+		for (sum_map::iterator it = mp_sum.begin(); it != mp_sum.end(); ++it, ++n) {
+			if (n % 5 == 0) {
+				it->second += 1000;
+				refresh_value(mp_sum, it);
+			}
+		}
+		int k = get_nth(mp_order, 3)->first;
+		mp_sum[k] = -5000;
+		refresh_value(mp_sum, mp_sum.find(k));
+		std::cout << "sum after refresh: " << (check_order_statistics(mp_sum, sum_type()) ? "OK" : "KO") << std::endl;
+		std::cout << "sum [0, 200): " << get_aggregate(mp_sum, 0, 200, sum_type()) << std::endl;
+	}
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== split | join =====" << std::endl;
+	{
+		typedef TESTED_NAMESPACE::map<int, long> base_map;
+		typedef with_augment<base_map, void>::type order_map;
+		typedef TESTED_NAMESPACE::pair<const int, long> value_type;
+		typedef TESTED_NAMESPACE::map<int, long, TESTED_NAMESPACE::less<int>, ft::arena_allocator<value_type> > arena_map;
+
+		std::cout << "+++ plain +++" << std::endl;
+		base_map mp_plain, other_plain;
+		test_split_join(mp_plain, other_plain);
+
+		std::cout << "+++ size augment +++" << std::endl;
+		order_map mp_order, other_order;
+		test_split_join(mp_order, other_order);
+
+		// reserve한 map의 노드는 옮길 수 없으므로 하나씩 복사한다.
+		std::cout << "+++ reserved left +++" << std::endl;
+		order_map mp_reserved, other_free;
+		reserve_nodes(mp_reserved, 64);
+		test_split_join(mp_reserved, other_free);
+
+		std::cout << "+++ reserved right +++" << std::endl;
+		base_map mp_free, other_reserved;
+		reserve_nodes(other_reserved, 64);
+		test_split_join(mp_free, other_reserved);
+
+		// allocator가 다르면 (다른 arena) 노드를 옮길 수 없다.
+		std::cout << "+++ different allocators +++" << std::endl;
+		ft::arena arena_left, arena_right;
+		arena_map mp_arena(TESTED_NAMESPACE::less<int>(), arena_left);
+		arena_map other_arena(TESTED_NAMESPACE::less<int>(), arena_right);
+		test_split_join(mp_arena, other_arena);
+	}
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== multimap =====" << std::endl;
+	lst.clear();
+	for (unsigned int i = 0; i < 12; ++i)
+		lst.push_back(T3(i % 4, std::string(1, 'a' + i)));
+	TESTED_NAMESPACE::multimap<T1, T2> mmp(lst.begin(), lst.end());
+	printContainers(mmp);
+
+	mmp.insert(T3(2, "late"));
+	mmp.insert(mmp.end(), T3(7, "end"));
+	mmp.insert(mmp.begin(), T3(0, "front"));
+	mmp.insert(mmp.find(3), T3(3, "hint"));
+	printContainers(mmp);
+
+	std::cout << "count 2: " << mmp.count(2) << std::endl;
+	std::cout << "count 5: " << mmp.count(5) << std::endl;
+	std::cout << "find 3: " << mmp.find(3)->second << std::endl;
+	std::cout << "equal_range 1: " << mmp.equal_range(1).first->second << " ~ " << mmp.equal_range(1).second->second << std::endl;
+	std::cout << "equal_range 5: " << ((mmp.equal_range(5).first == mmp.equal_range(5).second) ? "empty" : "KO") << std::endl;
+	std::cout << "erase 2: " << mmp.erase(2) << std::endl;
+	mmp.erase(mmp.begin());
+	mmp.erase(mmp.lower_bound(3), mmp.end());
+	printContainers(mmp);
+
+	TESTED_NAMESPACE::multimap<T1, T2> mmp_copy(mmp);
+	std::cout << "operator==: " << ((mmp == mmp_copy) ? "OK" : "KO") << std::endl;
+	mmp_copy.insert(T3(1, "z"));
+	std::cout << "operator<:  " << ((mmp < mmp_copy) ? "OK" : "KO") << std::endl;
+	swap(mmp, mmp_copy);
+	printContainers(mmp);
+	mmp.clear();
+	printContainers(mmp);
+
+#if __cplusplus >= 201103L
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== move | emplace (c++11) =====" << std::endl;
+	TESTED_NAMESPACE::pair<int, MoveOnly> pr_move(1, MoveOnly(10));
+	TESTED_NAMESPACE::pair<int, MoveOnly> pr_moved(std::move(pr_move));
+	std::cout << "pair move constructor: " << pr_moved.second.value << "\tmoved-from: " << pr_move.second.value << std::endl;
+	pr_move = std::move(pr_moved);
+	std::cout << "pair move assignment: " << pr_move.second.value << "\tmoved-from: " << pr_moved.second.value << std::endl;
+
+	TESTED_NAMESPACE::map<T1, MoveOnly> mp_move;
+	std::cout << "emplace: " << mp_move.emplace(3, MoveOnly(30)).second << std::endl;
+	std::cout << "emplace same: " << mp_move.emplace(3, MoveOnly(31)).second << "\tvalue: " << mp_move.find(3)->second.value << std::endl;
+	std::cout << "emplace_hint: " << mp_move.emplace_hint(mp_move.end(), 5, MoveOnly(50))->second.value << std::endl;
+	TESTED_NAMESPACE::map<T1, MoveOnly>::value_type val_insert(1, MoveOnly(10));
+	std::cout << "insert: " << mp_move.insert(std::move(val_insert)).first->second.value;
+	std::cout << "\tmoved-from: " << val_insert.second.value << std::endl;
+	TESTED_NAMESPACE::map<T1, MoveOnly>::value_type val_hint(4, MoveOnly(40));
+	std::cout << "insert hint: " << mp_move.insert(mp_move.find(5), std::move(val_hint))->second.value;
+	std::cout << "\tmoved-from: " << val_hint.second.value << std::endl;
+	mp_move[2] = MoveOnly(20);
+	for (TESTED_NAMESPACE::map<T1, MoveOnly>::iterator it = mp_move.begin(); it != mp_move.end(); ++it)
+		std::cout << "- key: " << it->first << "\t& value: " << it->second.value << std::endl;
+
+	TESTED_NAMESPACE::map<T1, MoveOnly> mp_moved(std::move(mp_move));
+	std::cout << "move constructor: " << mp_moved.size() << "\tmoved-from size: " << mp_move.size() << std::endl;
+	TESTED_NAMESPACE::map<T1, MoveOnly> mp_move_assign;
+	mp_move_assign.emplace(42, MoveOnly(42));
+	mp_move_assign = std::move(mp_moved);
+	std::cout << "move assignment: " << mp_move_assign.size() << "\tmoved-from size: " << mp_moved.size() << std::endl;
+	std::cout << "first: " << mp_move_assign.begin()->second.value << "\tlast: " << (--mp_move_assign.end())->second.value << std::endl;
+	mp_moved.emplace(7, MoveOnly(70));
+	std::cout << "reuse moved-from: " << mp_moved.size() << " " << mp_moved.begin()->second.value << std::endl;
+
+	TESTED_NAMESPACE::multimap<T1, MoveOnly> mmp_move;
+	mmp_move.emplace(2, MoveOnly(20));
+	mmp_move.emplace(2, MoveOnly(21));
+	mmp_move.emplace_hint(mmp_move.end(), 4, MoveOnly(40));
+	TESTED_NAMESPACE::multimap<T1, MoveOnly>::value_type val_multi(2, MoveOnly(22));
+	mmp_move.insert(std::move(val_multi));
+	std::cout << "multimap count 2: " << mmp_move.count(2) << "\tmoved-from: " << val_multi.second.value << std::endl;
+	for (TESTED_NAMESPACE::multimap<T1, MoveOnly>::iterator it = mmp_move.begin(); it != mmp_move.end(); ++it)
+		std::cout << "- key: " << it->first << "\t& value: " << it->second.value << std::endl;
+	TESTED_NAMESPACE::multimap<T1, MoveOnly> mmp_moved(std::move(mmp_move));
+	std::cout << "multimap move: " << mmp_moved.size() << "\tmoved-from size: " << mmp_move.size() << std::endl;
+#endif
 }
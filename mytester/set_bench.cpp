@@ -0,0 +1,201 @@
+#include "set.hpp"
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <new>
+#include <set>
+#include <string>
+#include <vector>
+
+#ifndef TESTED_NAMESPACE
+#define TESTED_NAMESPACE ft
+#endif
+
+#define T1 int
+#define SET TESTED_NAMESPACE::set<T1>
+#define MULTISET TESTED_NAMESPACE::multiset<T1>
+
+// 힙 할당 횟수와 요청 바이트를 세기 위해 전역 operator new를 교체한다.
+#if __cplusplus >= 201103L
+# define BENCH_THROW_BAD_ALLOC
+#else
+# define BENCH_THROW_BAD_ALLOC throw(std::bad_alloc)
+#endif
+
+// 교체한 operator new/delete가 인라인되면 gcc가 malloc/free 짝을 오인하므로 인라인을 막는다.
+#if defined(__GNUC__)
+# define BENCH_NOINLINE __attribute__((noinline))
+#else
+# define BENCH_NOINLINE
+#endif
+
+static size_t g_alloc_count = 0;
+static size_t g_alloc_bytes = 0;
+
+BENCH_NOINLINE void* operator new(size_t size) BENCH_THROW_BAD_ALLOC {
+	g_alloc_count++;
+	g_alloc_bytes += size;
+	void* res = std::malloc(size ? size : 1);
+	if (res == NULL)
+		throw std::bad_alloc();
+	return (res);
+}
+
+BENCH_NOINLINE void operator delete(void* ptr) throw() {
+	std::free(ptr);
+}
+
+#if __cplusplus >= 201402L
+BENCH_NOINLINE void operator delete(void* ptr, size_t) throw() {
+	std::free(ptr);
+}
+#endif
+
+// 측정 시간을 ns 단위로 반환한다.
+static double elapsed_ns(clock_t start) {
+	return (static_cast<double>(clock() - start) * 1e9 / CLOCKS_PER_SEC);
+}
+
+static void printResult(const char* name, size_t n, double total_ns, size_t ops) {
+	std::cout << name << "\tn: " << n << "\t" << (total_ns / ops) << " ns/op" << std::endl;
+}
+
+// 섞인 순서 / 오름차순(end() hint)으로 n개를 넣는 비용과 요소 하나당 할당 바이트를 잰다.
+// set의 노드에는 key만 들어가므로 같은 key의 map보다 노드가 작아야 한다.
+static void bench_insert() {
+	for (size_t n = 1000; n <= 1000000; n *= 1000) {
+		const size_t rounds = 1000000 / n;
+		size_t bytes = g_alloc_bytes;
+		clock_t start = clock();
+		for (size_t r = 0; r < rounds; ++r) {
+			SET st;
+			for (size_t i = 0; i < n; ++i)
+				st.insert(static_cast<T1>((i * 7919) % n));
+		}
+		printResult("insert random", n, elapsed_ns(start), n * rounds);
+		std::cout << "insert random\tn: " << n << "\t"
+			<< static_cast<double>(g_alloc_bytes - bytes) / (n * rounds) << " bytes/elem" << std::endl;
+
+		start = clock();
+		for (size_t r = 0; r < rounds; ++r) {
+			SET st;
+			for (size_t i = 0; i < n; ++i)
+				st.insert(st.end(), static_cast<T1>(i));
+		}
+		printResult("insert sorted (hint end)", n, elapsed_ns(start), n * rounds);
+	}
+}
+
+// 있는 key / 없는 key로 find, count 를 부르는 비용을 잰다.
+static void bench_find() {
+	const size_t n = 1000000;
+	SET st;
+	for (size_t i = 0; i < n; ++i)
+		st.insert(st.end(), static_cast<T1>(i * 2));
+
+	const size_t queries = 2000000;
+	long sink = 0;
+	clock_t start = clock();
+	for (size_t i = 0; i < queries; ++i) {
+		T1 k = static_cast<T1>((i * 7919) % (n * 2));
+		sink += (st.find(k) == st.end());
+		sink += st.count(k + 1);
+	}
+	printResult("find | count", n, elapsed_ns(start), queries);
+	if (sink == 42)
+		std::cout << std::endl;
+}
+
+// 길이가 긴 string key로 insert / find 비용을 잰다.
+static void bench_string() {
+	const size_t n = 100000;
+	const std::string prefix(64, 's');
+	std::vector<std::string> keys;
+	for (size_t i = 0; i < n; ++i) {
+		std::string k(prefix);
+		for (size_t v = (i * 7919) % n; v > 0; v /= 10)
+			k += static_cast<char>('0' + v % 10);
+		keys.push_back(k);
+	}
+
+	TESTED_NAMESPACE::set<std::string> st;
+	clock_t start = clock();
+	for (size_t i = 0; i < n; ++i)
+		st.insert(keys[i]);
+	printResult("insert<string>", n, elapsed_ns(start), n);
+
+	long sink = 0;
+	start = clock();
+	for (size_t r = 0; r < 10; ++r) {
+		for (size_t i = 0; i < n; ++i)
+			sink += (st.find(keys[i]) == st.end());
+	}
+	printResult("find<string>", n, elapsed_ns(start), n * 10);
+	if (sink == 42)
+		std::cout << std::endl;
+}
+
+// 앞에서부터 전부 훑는 비용과 erase / insert 를 반복하는 비용을 잰다.
+static void bench_iterate_erase() {
+	const size_t n = 1000000;
+	SET st;
+	for (size_t i = 0; i < n; ++i)
+		st.insert(static_cast<T1>((i * 7919) % n));
+
+	long sink = 0;
+	clock_t start = clock();
+	for (size_t r = 0; r < 10; ++r) {
+		for (SET::const_iterator it = st.begin(); it != st.end(); ++it)
+			sink += *it;
+	}
+	printResult("iterate", n, elapsed_ns(start), n * 10);
+
+	const size_t ops = 1000000;
+	start = clock();
+	for (size_t i = 0; i < ops; ++i) {
+		T1 k = static_cast<T1>((i * 7919) % n);
+		st.erase(k);
+		st.insert(k);
+	}
+	printResult("erase / insert churn", n, elapsed_ns(start), ops);
+	if (sink == 42)
+		std::cout << std::endl;
+}
+
+// 같은 key가 많이 겹치는 multiset의 insert, count, erase(key) 비용을 잰다.
+static void bench_multiset() {
+	const size_t n = 1000000;
+	const size_t keys = 1000;
+	MULTISET st;
+	clock_t start = clock();
+	for (size_t i = 0; i < n; ++i)
+		st.insert(static_cast<T1>((i * 7919) % keys));
+	printResult("multiset insert (1000 keys)", n, elapsed_ns(start), n);
+
+	long sink = 0;
+	start = clock();
+	for (size_t i = 0; i < keys; ++i)
+		sink += st.count(static_cast<T1>(i));
+	printResult("multiset count", n, elapsed_ns(start), keys);
+
+	start = clock();
+	for (size_t i = 0; i < keys; ++i)
+		sink += st.erase(static_cast<T1>(i));
+	printResult("multiset erase(key)", n, elapsed_ns(start), keys);
+	if (sink == 42 || !st.empty())
+		std::cout << std::endl;
+}
+
+int main() {
+	std::cout << "################ Bench Set ################" << std::endl;
+	std::cout << "===== insert =====" << std::endl;
+	bench_insert();
+	std::cout << "===== find | count =====" << std::endl;
+	bench_find();
+	std::cout << "===== string keys =====" << std::endl;
+	bench_string();
+	std::cout << "===== iterate | erase =====" << std::endl;
+	bench_iterate_erase();
+	std::cout << "===== multiset =====" << std::endl;
+	bench_multiset();
+}
@@ -8,6 +8,24 @@
 #define TESTED_NAMESPACE ft
 #endif
 
+#if __cplusplus >= 201103L
+// 복사할 수 없고 옮기면 원래 값이 -1이 되는 타입 (move / emplace 경로 확인)
+struct MoveOnly {
+	int value;
+
+	MoveOnly(int v = 0) : value(v) {}
+	MoveOnly(const MoveOnly&) = delete;
+	MoveOnly& operator=(const MoveOnly&) = delete;
+	MoveOnly(MoveOnly&& x) noexcept : value(x.value) { x.value = -1; }
+	MoveOnly& operator=(MoveOnly&& x) noexcept {
+		value = x.value;
+		x.value = -1;
+		return (*this);
+	}
+	bool operator<(const MoveOnly& x) const { return (value < x.value); }
+};
+#endif
+
 #define T1 int
 #define T3 TESTED_NAMESPACE::set<T1>::value_type
 #define T_SIZE_TYPE typename TESTED_NAMESPACE::set<T1>::size_type
@@ -136,4 +154,73 @@ int main() {
 	std::cout << "operator<=: " << ((lhs <= rhs) ? "OK" : "KO") << std::endl;
 	std::cout << "operator>:  " << ((lhs > rhs) ? "OK" : "KO") << std::endl;
 	std::cout << "operator>=: " << ((lhs >= rhs) ? "OK" : "KO") << std::endl;
-} 
+
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== multiset =====" << std::endl;
+	lst.clear();
+	for (unsigned int i = 0; i < 12; ++i)
+		lst.push_back(T3(i % 4));
+	TESTED_NAMESPACE::multiset<T1> mst(lst.begin(), lst.end());
+	printContainers(mst);
+
+	mst.insert(2);
+	mst.insert(mst.end(), 7);
+	mst.insert(mst.begin(), 0);
+	mst.insert(mst.find(3), 3);
+	printContainers(mst);
+
+	std::cout << "count 2: " << mst.count(2) << std::endl;
+	std::cout << "count 5: " << mst.count(5) << std::endl;
+	std::cout << "find 3 is first 3: " << ((mst.find(3) == mst.lower_bound(3)) ? "OK" : "KO") << std::endl;
+	std::cout << "equal_range 1: " << *mst.equal_range(1).first << " ~ " << *mst.equal_range(1).second << std::endl;
+	std::cout << "erase 2: " << mst.erase(2) << std::endl;
+	mst.erase(mst.begin());
+	mst.erase(mst.lower_bound(3), mst.end());
+	printContainers(mst);
+
+	TESTED_NAMESPACE::multiset<T1> mst_copy(mst);
+	std::cout << "operator==: " << ((mst == mst_copy) ? "OK" : "KO") << std::endl;
+	mst_copy.insert(1);
+	std::cout << "operator<:  " << ((mst < mst_copy) ? "OK" : "KO") << std::endl;
+	swap(mst, mst_copy);
+	printContainers(mst);
+	mst.clear();
+	printContainers(mst);
+
+#if __cplusplus >= 201103L
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== move | emplace (c++11) =====" << std::endl;
+	TESTED_NAMESPACE::set<MoveOnly> st_move;
+	std::cout << "emplace: " << st_move.emplace(3).second << std::endl;
+	std::cout << "emplace same: " << st_move.emplace(3).second << std::endl;
+	MoveOnly mo_insert(1);
+	std::cout << "insert: " << st_move.insert(std::move(mo_insert)).first->value;
+	std::cout << "\tmoved-from: " << mo_insert.value << std::endl;
+	MoveOnly mo_hint(5);
+	std::cout << "insert hint: " << st_move.insert(st_move.end(), std::move(mo_hint))->value;
+	std::cout << "\tmoved-from: " << mo_hint.value << std::endl;
+	std::cout << "emplace_hint: " << st_move.emplace_hint(st_move.begin(), 0)->value << std::endl;
+	for (TESTED_NAMESPACE::set<MoveOnly>::iterator it = st_move.begin(); it != st_move.end(); ++it)
+		std::cout << "- " << it->value << std::endl;
+
+	TESTED_NAMESPACE::set<MoveOnly> st_moved(std::move(st_move));
+	std::cout << "move constructor: " << st_moved.size() << "\tmoved-from size: " << st_move.size() << std::endl;
+	TESTED_NAMESPACE::set<MoveOnly> st_move_assign;
+	st_move_assign.emplace(42);
+	st_move_assign = std::move(st_moved);
+	std::cout << "move assignment: " << st_move_assign.size() << "\tmoved-from size: " << st_moved.size() << std::endl;
+	std::cout << "first: " << st_move_assign.begin()->value << "\tlast: " << (--st_move_assign.end())->value << std::endl;
+	st_moved.emplace(7);
+	std::cout << "reuse moved-from: " << st_moved.size() << " " << st_moved.begin()->value << std::endl;
+
+	TESTED_NAMESPACE::multiset<MoveOnly> mst_move;
+	mst_move.emplace(2);
+	mst_move.emplace(2);
+	mst_move.emplace_hint(mst_move.end(), 4);
+	MoveOnly mo_multi(2);
+	mst_move.insert(std::move(mo_multi));
+	std::cout << "multiset count 2: " << mst_move.count(MoveOnly(2)) << "\tmoved-from: " << mo_multi.value << std::endl;
+	TESTED_NAMESPACE::multiset<MoveOnly> mst_moved(std::move(mst_move));
+	std::cout << "multiset move: " << mst_moved.size() << "\tmoved-from size: " << mst_move.size() << std::endl;
+#endif
+}
@@ -10,6 +10,24 @@
 #define TESTED_NAMESPACE ft
 #endif
 
+#if __cplusplus >= 201103L
+// 복사할 수 없고 옮기면 원래 값이 -1이 되는 타입 (move / emplace 경로 확인)
+struct MoveOnly {
+	int value;
+
+	MoveOnly(int v = 0) : value(v) {}
+	MoveOnly(const MoveOnly&) = delete;
+	MoveOnly& operator=(const MoveOnly&) = delete;
+	MoveOnly(MoveOnly&& x) noexcept : value(x.value) { x.value = -1; }
+	MoveOnly& operator=(MoveOnly&& x) noexcept {
+		value = x.value;
+		x.value = -1;
+		return (*this);
+	}
+	bool operator<(const MoveOnly& x) const { return (value < x.value); }
+};
+#endif
+
 #define TYPE int
 #define T_SIZE_TYPE typename TESTED_NAMESPACE::stack<T>::size_type
 #define UNDERLYING std::vector<TYPE>
@@ -141,4 +159,30 @@ int main() {
 
 	std::cout << "operator >=" << std::endl;
 	std::cout << ((lhs >= rhs) ? "OK" : "KO") << std::endl;
+
+#if __cplusplus >= 201103L
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== move | emplace (c++11) =====" << std::endl;
+	TESTED_NAMESPACE::stack<MoveOnly> st_move;
+	MoveOnly mo_push(1);
+	st_move.push(std::move(mo_push));
+	st_move.emplace(2);
+	st_move.emplace(3);
+	std::cout << "moved-from after push: " << mo_push.value << std::endl;
+	std::cout << "size: " << st_move.size() << "\ttop: " << st_move.top().value << std::endl;
+
+	TESTED_NAMESPACE::stack<MoveOnly> st_moved(std::move(st_move));
+	std::cout << "move constructor: " << st_moved.size() << "\tmoved-from size: " << st_move.size() << std::endl;
+	TESTED_NAMESPACE::stack<MoveOnly> st_move_assign;
+	st_move_assign = std::move(st_moved);
+	std::cout << "move assignment: " << st_move_assign.size() << "\tmoved-from size: " << st_moved.size() << std::endl;
+	while (!st_move_assign.empty()) {
+		std::cout << "- " << st_move_assign.top().value << std::endl;
+		st_move_assign.pop();
+	}
+
+	UNDERLYING ctnr(3, 9);
+	TESTED_NAMESPACE::stack<TYPE, UNDERLYING> st_from_ctnr(std::move(ctnr));
+	std::cout << "from container: " << st_from_ctnr.size() << "\ttop: " << st_from_ctnr.top() << std::endl;
+#endif
 }
@@ -0,0 +1,156 @@
+#include "vector.hpp"
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifndef TESTED_NAMESPACE
+#define TESTED_NAMESPACE ft
+#endif
+
+// 측정 시간을 ns 단위로 반환한다.
+static double elapsed_ns(clock_t start) {
+	return (static_cast<double>(clock() - start) * 1e9 / CLOCKS_PER_SEC);
+}
+
+static void printResult(const char* name, size_t n, double total_ns, size_t ops) {
+	std::cout << name << "\tn: " << n << "\t" << (total_ns / ops) << " ns/op" << std::endl;
+}
+
+// 재할당(reserve), 복사, 앞쪽 insert/erase 처럼 요소를 통째로 옮기는 경로의 비용을 잰다.
+template <typename T>
+static void bench_relocation(const char* name) {
+	const size_t n = 10000;
+	const size_t rounds = 20000;
+	std::cout << "--- " << name << " ---" << std::endl;
+
+	TESTED_NAMESPACE::vector<T> vec(n, T());
+	clock_t start = clock();
+	for (size_t i = 0; i < rounds; ++i) {
+		TESTED_NAMESPACE::vector<T> tmp(vec);
+		tmp.reserve(n * 2);
+	}
+	printResult("copy + reserve", n, elapsed_ns(start), rounds);
+
+	start = clock();
+	for (size_t i = 0; i < rounds; ++i) {
+		vec.insert(vec.begin(), T());
+		vec.erase(vec.begin());
+	}
+	printResult("insert/erase front", n, elapsed_ns(start), rounds);
+
+	start = clock();
+	for (size_t i = 0; i < rounds; ++i) {
+		TESTED_NAMESPACE::vector<T> tmp;
+		tmp = vec;
+	}
+	printResult("assign", n, elapsed_ns(start), rounds);
+
+	// 같은 내용의 두 벡터를 swap (요소를 비교하지 않아야 한다)
+	TESTED_NAMESPACE::vector<T> other(vec);
+	start = clock();
+	for (size_t i = 0; i < rounds; ++i)
+		vec.swap(other);
+	printResult("swap", n, elapsed_ns(start), rounds);
+}
+
+// 요소가 자기 버퍼를 가진 타입(string, 벡터의 벡터)을 push_back 으로 키울 때의 비용을 잰다.
+// 재할당마다 요소를 깊은 복사하지 않고 swap으로 옮기는지를 본다.
+template <typename T>
+static void bench_growth(const char* name, const T& val) {
+	const size_t n = 100000;
+	const size_t rounds = 8;
+
+	clock_t start = clock();
+	for (size_t r = 0; r < rounds; ++r) {
+		TESTED_NAMESPACE::vector<T> vec;
+		for (size_t i = 0; i < n; ++i)
+			vec.push_back(val);
+	}
+	printResult(name, n, elapsed_ns(start), n * rounds);
+
+	TESTED_NAMESPACE::vector<T> vec(n, val);
+	start = clock();
+	for (size_t r = 0; r < rounds; ++r)
+		vec.reserve(vec.capacity() * 2);
+	printResult("reserve", n, elapsed_ns(start), n * rounds);
+}
+
+// insert 한 개씩을 반복할 때의 비용과 재할당 횟수를 잰다.
+// end - 항상 end()에 삽입 (push_back 과 같은 성장)
+// middle - 가운데에 삽입, 요소를 옮기는 비용 때문에 n이 크면 1000번만 넣는다.
+static void bench_insert() {
+	for (size_t n = 100000; n <= 10000000; n *= 10) {
+		TESTED_NAMESPACE::vector<int> vec;
+		size_t reallocs = 0;
+		size_t capacity = vec.capacity();
+		clock_t start = clock();
+		for (size_t i = 0; i < n; ++i) {
+			vec.insert(vec.end(), static_cast<int>(i));
+			if (vec.capacity() != capacity) {
+				capacity = vec.capacity();
+				reallocs++;
+			}
+		}
+		printResult("insert end", n, elapsed_ns(start), n);
+		std::cout << "insert end\tn: " << n << "\t" << reallocs << " reallocs" << std::endl;
+
+		const size_t ops = 1000;
+		reallocs = 0;
+		start = clock();
+		for (size_t i = 0; i < ops; ++i) {
+			vec.insert(vec.begin() + vec.size() / 2, static_cast<int>(i));
+			if (vec.capacity() != capacity) {
+				capacity = vec.capacity();
+				reallocs++;
+			}
+		}
+		printResult("insert middle", n, elapsed_ns(start), ops);
+		std::cout << "insert middle\tn: " << n << "\t" << reallocs << " reallocs" << std::endl;
+	}
+}
+
+// 컴파일러가 반복문 밖으로 비교를 빼내지 못하도록 매번 값을 다시 쓴다.
+static volatile int g_zero = 0;
+
+// 같은 내용의 큰 벡터를 ==, < 로 비교하는 비용을 잰다. (끝까지 비교해야 하는 최악의 경우)
+template <typename T>
+static void bench_compare(const char* name) {
+	const size_t n = 1000000;
+	const size_t rounds = 200;
+	TESTED_NAMESPACE::vector<T> lhs(n, T(7));
+	TESTED_NAMESPACE::vector<T> rhs(lhs);
+	long sink = 0;
+
+	clock_t start = clock();
+	for (size_t i = 0; i < rounds; ++i) {
+		rhs.back() = static_cast<T>(7 + g_zero);
+		sink += (lhs == rhs);
+	}
+	printResult(name, n, elapsed_ns(start), rounds);
+
+	start = clock();
+	for (size_t i = 0; i < rounds; ++i) {
+		rhs.back() = static_cast<T>(7 + g_zero);
+		sink += (lhs < rhs);
+	}
+	printResult("operator<", n, elapsed_ns(start), rounds);
+	if (sink == 42)
+		std::cout << std::endl;
+}
+
+int main() {
+	std::cout << "################ Bench Vector ################" << std::endl;
+	std::cout << "===== relocation =====" << std::endl;
+	bench_relocation<int>("int");
+	bench_relocation<double>("double");
+	std::cout << "===== operator== | operator< =====" << std::endl;
+	bench_compare<unsigned char>("vector<uchar> ==");
+	bench_compare<char>("vector<char> ==");
+	bench_compare<int>("vector<int> ==");
+	std::cout << "===== insert =====" << std::endl;
+	bench_insert();
+	std::cout << "===== push_back growth =====" << std::endl;
+	bench_growth<std::string>("vector<string>", std::string(64, 'x'));
+	bench_growth<TESTED_NAMESPACE::vector<int> >("vector<vector<int>>", TESTED_NAMESPACE::vector<int>(16, 42));
+}
@@ -1,5 +1,9 @@
 #include "vector.hpp"
+#include "arena_allocator.hpp"
 #include <iostream>
+#include <iterator>
+#include <list>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -7,6 +11,43 @@
 #define TESTED_NAMESPACE ft
 #endif
 
+#if __cplusplus >= 201103L
+// 복사할 수 없고 옮기면 원래 값이 -1이 되는 타입 (move / emplace 경로 확인)
+struct MoveOnly {
+	int value;
+
+	MoveOnly(int v = 0) : value(v) {}
+	MoveOnly(const MoveOnly&) = delete;
+	MoveOnly& operator=(const MoveOnly&) = delete;
+	MoveOnly(MoveOnly&& x) noexcept : value(x.value) { x.value = -1; }
+	MoveOnly& operator=(MoveOnly&& x) noexcept {
+		value = x.value;
+		x.value = -1;
+		return (*this);
+	}
+	bool operator<(const MoveOnly& x) const { return (value < x.value); }
+};
+#endif
+
+// 숫자 필드만 가진 POD 구조체. c++11 이상은 ft::is_trivially_copyable이 알아서 true가 된다.
+struct Point {
+	int id;
+	double x;
+	double y;
+};
+
+#if __cplusplus < 201103L
+namespace ft {
+	template <>
+	struct is_trivially_copyable<Point> : public true_type {};
+}
+#endif
+
+static Point make_point(int id) {
+	Point res = { id, id * 0.5, id * -1.25 };
+	return (res);
+}
+
 #define TYPE int
 #define T_SIZE_TYPE typename TESTED_NAMESPACE::vector<T>::size_type
 
@@ -28,6 +69,96 @@ void printContainers(TESTED_NAMESPACE::vector<T> const &vec, bool print_content
 	std::cout << "------------------------" << std::endl;
 }
 
+// adopt / release는 ft::vector의 확장이다.
+// std는 같은 크기의 버퍼를 swap으로 넘겨 같은 결과(size, capacity, 요소)를 만든다.
+template <typename V>
+void move_buffer(V& dst, V& src) {
+	dst.swap(src);
+	V().swap(src);
+}
+
+template <typename T, typename A>
+void move_buffer(ft::vector<T, A>& dst, ft::vector<T, A>& src) {
+	typename ft::vector<T, A>::size_type size = src.size();
+	typename ft::vector<T, A>::size_type capacity = src.capacity();
+
+	dst.adopt(src.release(), size, capacity);
+}
+
+// allocator로 직접 capacity만큼 할당해 앞의 size개를 채운 버퍼를 vec에 넘긴다.
+template <typename V>
+void adopt_filled(V& vec, typename V::size_type size, typename V::size_type capacity) {
+	V tmp;
+	tmp.reserve(capacity);
+	for (typename V::size_type i = 0; i < size; ++i)
+		tmp.push_back(i * 11);
+	vec.swap(tmp);
+}
+
+template <typename T, typename A>
+void adopt_filled(ft::vector<T, A>& vec, typename ft::vector<T, A>::size_type size, typename ft::vector<T, A>::size_type capacity) {
+	A alloc = vec.get_allocator();
+	typename A::pointer buffer = alloc.allocate(capacity);
+	for (typename A::size_type i = 0; i < size; ++i)
+		alloc.construct(buffer + i, i * 11);
+	vec.adopt(buffer, size, capacity);
+}
+
+// 버퍼를 꺼내 요소를 소멸시키고 allocator로 해제한다.
+template <typename V>
+void drop_buffer(V& vec) {
+	V().swap(vec);
+}
+
+template <typename T, typename A>
+void drop_buffer(ft::vector<T, A>& vec) {
+	typename ft::vector<T, A>::size_type size = vec.size();
+	typename ft::vector<T, A>::size_type capacity = vec.capacity();
+	A alloc = vec.get_allocator();
+	typename A::pointer buffer = vec.release();
+
+	for (typename A::size_type i = 0; i < size; ++i)
+		alloc.destroy(buffer + i);
+	alloc.deallocate(buffer, capacity);
+}
+
+// 안쪽 vector의 allocate 호출 횟수를 센다.
+static std::size_t inner_allocs = 0;
+
+template <typename T>
+struct CountingAlloc : public std::allocator<T> {
+	template <typename U>
+	struct rebind { typedef CountingAlloc<U> other; };
+
+	CountingAlloc() {}
+	template <typename U>
+	CountingAlloc(const CountingAlloc<U>&) {}
+
+	T* allocate(std::size_t n, const void* = 0) {
+		++inner_allocs;
+		return (std::allocator<T>::allocate(n));
+	}
+	void deallocate(T* ptr, std::size_t n) { std::allocator<T>::deallocate(ptr, n); }
+};
+
+template <typename T, typename U>
+bool operator==(const CountingAlloc<T>&, const CountingAlloc<U>&) { return (true); }
+
+template <typename T, typename U>
+bool operator!=(const CountingAlloc<T>&, const CountingAlloc<U>&) { return (false); }
+
+// 바깥 vector가 재할당할 때 안쪽 vector의 버퍼는 다시 할당하지 않는다. (c++98은 swap, c++11은 move)
+// std는 c++98에서 요소를 복사하므로 확인하지 않는다.
+template <typename V>
+bool no_inner_allocs(const V&, std::size_t) {
+	return (true);
+}
+
+template <typename T, typename A>
+bool no_inner_allocs(const ft::vector<T, A>&, std::size_t allocs) {
+	return (allocs == 0);
+}
+
 int main() {
 	std::cout << "################ Test Vector ################" << std::endl;
 
@@ -134,6 +265,17 @@ int main() {
 	printContainers(vecA);
 	printContainers(vecB);
 
+	std::cout << "range from list (forward) | istream (input): " << std::endl;
+	std::list<TYPE> lst;
+	for (unsigned int i = 0; i < 4; ++i)
+		lst.push_back(i * 3);
+	std::istringstream iss("7 8 9");
+	TESTED_NAMESPACE::vector<TYPE> vecE(lst.begin(), lst.end());
+	vecE.insert(vecE.begin() + 1, std::istream_iterator<TYPE>(iss), std::istream_iterator<TYPE>());
+	printContainers(vecE);
+	vecA.assign(lst.begin(), lst.end());
+	printContainers(vecA);
+
 	std::cout << "\n################################################" << std::endl;
 	std::cout << "===== push_back | pop_back =====" << std::endl;
 	TESTED_NAMESPACE::vector<TYPE> v_pushpop;
@@ -157,6 +299,74 @@ int main() {
 	printContainers(v_pushpop);
 	std::cout << "capacity: " << v_pushpop.capacity() << std::endl;
 
+	// 재할당할 때 요소를 옮기는 빈 vector는 기본 생성자가 없는 allocator로도 만들 수 있어야 한다.
+	std::cout << "+++ push nested vector (arena_allocator) +++" << std::endl;
+	ft::arena arena;
+	ft::arena_allocator<TYPE> arena_alloc(arena);
+	TESTED_NAMESPACE::vector< TESTED_NAMESPACE::vector<TYPE, ft::arena_allocator<TYPE> > > v_nested;
+	for (unsigned int i = 0; i < 5; ++i)
+		v_nested.push_back(TESTED_NAMESPACE::vector<TYPE, ft::arena_allocator<TYPE> >(i + 1, i * 10, arena_alloc));
+	v_nested.insert(v_nested.begin(), TESTED_NAMESPACE::vector<TYPE, ft::arena_allocator<TYPE> >(2, 7, arena_alloc));
+	v_nested.erase(v_nested.begin() + 2);
+	std::cout << "size: " << v_nested.size() << std::endl;
+	for (unsigned int i = 0; i < v_nested.size(); ++i) {
+		std::cout << "- ";
+		for (unsigned int j = 0; j < v_nested[i].size(); ++j)
+			std::cout << v_nested[i][j] << " ";
+		std::cout << "(same arena: " << ((v_nested[i].get_allocator() == arena_alloc) ? "OK" : "KO") << ")" << std::endl;
+	}
+
+	// 빈 요소와 채워진 요소가 섞인 vector를 담은 vector를 재할당해도 안쪽에서 할당이 일어나지 않아야 한다.
+	std::cout << "+++ nested vector regrowth (allocation count) +++" << std::endl;
+	{
+		typedef TESTED_NAMESPACE::vector<TYPE, CountingAlloc<TYPE> > inner_vector;
+		TESTED_NAMESPACE::vector<inner_vector> v_outer;
+		inner_vector empty_inner;
+		inner_vector copied_empty(empty_inner);
+		std::cout << "copy of empty vector capacity: " << copied_empty.capacity() << std::endl;
+		for (unsigned int i = 0; i < 1000; ++i) {
+			v_outer.push_back(empty_inner);
+			if (i % 2)
+				v_outer.back().assign(i % 7 + 1, i);
+		}
+		std::size_t before = inner_allocs;
+		v_outer.reserve(4000);
+		std::cout << "reserve: " << (no_inner_allocs(v_outer, inner_allocs - before) ? "OK" : "KO") << std::endl;
+		before = inner_allocs;
+		v_outer.insert(v_outer.begin(), 3500, empty_inner);
+		v_outer.erase(v_outer.begin(), v_outer.begin() + 100);
+		std::cout << "insert (regrowth): " << (no_inner_allocs(v_outer, inner_allocs - before) ? "OK" : "KO") << std::endl;
+		std::size_t total = 0;
+		long sum = 0;
+		for (unsigned int i = 0; i < v_outer.size(); ++i) {
+			total += v_outer[i].size();
+			for (unsigned int j = 0; j < v_outer[i].size(); ++j)
+				sum += v_outer[i][j];
+		}
+		std::cout << "size: " << v_outer.size() << "\tinner elements: " << total << "\tsum: " << sum << std::endl;
+	}
+
+	// POD 구조체는 재할당 / 삽입 / 복사를 memcpy, memmove로 한다.
+	std::cout << "+++ POD struct +++" << std::endl;
+	{
+		std::cout << "trivially copyable: " << ft::is_trivially_copyable<Point>::value
+			<< "\tstring: " << ft::is_trivially_copyable<std::string>::value << std::endl;
+		TESTED_NAMESPACE::vector<Point> v_pod;
+		for (int i = 0; i < 100; ++i)
+			v_pod.push_back(make_point(i));
+		v_pod.insert(v_pod.begin() + 10, 5, make_point(-1));
+		v_pod.erase(v_pod.begin() + 50, v_pod.begin() + 70);
+		TESTED_NAMESPACE::vector<Point> v_pod_copy(v_pod);
+		v_pod_copy.insert(v_pod_copy.begin(), v_pod.begin(), v_pod.begin() + 3);
+		v_pod.assign(v_pod_copy.begin() + 40, v_pod_copy.end());
+		double sum = 0;
+		for (unsigned int i = 0; i < v_pod_copy.size(); ++i)
+			sum += v_pod_copy[i].id + v_pod_copy[i].x + v_pod_copy[i].y;
+		std::cout << "size: " << v_pod_copy.size() << "\tsum: " << sum << std::endl;
+		for (unsigned int i = 0; i < v_pod.size(); i += 20)
+			std::cout << "- " << v_pod[i].id << " " << v_pod[i].x << " " << v_pod[i].y << std::endl;
+	}
+
 	std::cout << "\n################################################" << std::endl;
 	std::cout << "===== insert | erase =====" << std::endl;
 	TESTED_NAMESPACE::vector<TYPE> v_insert;
@@ -208,6 +418,34 @@ int main() {
 	printContainers(v_swapA);
 	printContainers(v_swapB);
 
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== adopt | release =====" << std::endl;
+	TESTED_NAMESPACE::vector<TYPE> v_owner;
+	TESTED_NAMESPACE::vector<TYPE> v_taker(3, 5);
+	adopt_filled(v_owner, 5, 8);
+	std::cout << "adopted buffer: " << std::endl;
+	std::cout << "capacity: " << v_owner.capacity() << std::endl;
+	printContainers(v_owner);
+
+	// v_taker가 이미 가진 요소와 버퍼는 해제되고 v_owner의 버퍼를 받는다.
+	move_buffer(v_taker, v_owner);
+	std::cout << "after release -> adopt: " << std::endl;
+	std::cout << "capacity: " << v_taker.capacity() << std::endl;
+	printContainers(v_taker);
+	std::cout << "released capacity: " << v_owner.capacity() << std::endl;
+	printContainers(v_owner);
+
+	v_taker.push_back(42);
+	v_owner.push_back(21);
+	std::cout << "push after hand-off: " << std::endl;
+	printContainers(v_taker);
+	printContainers(v_owner);
+
+	drop_buffer(v_taker);
+	std::cout << "after release -> free: " << std::endl;
+	std::cout << "capacity: " << v_taker.capacity() << std::endl;
+	printContainers(v_taker);
+
 	std::cout << "\n################################################" << std::endl;
 	std::cout << "===== clear =====" << std::endl;
 	TESTED_NAMESPACE::vector<TYPE> v_clear(7);
@@ -249,4 +487,33 @@ int main() {
 	std::cout << "operator<=: " << ((v_lhs <= v_rhs) ? "OK" : "KO") << std::endl;
 	std::cout << "operator>:  " << ((v_lhs > v_rhs) ? "OK" : "KO") << std::endl;
 	std::cout << "operator>=: " << ((v_lhs >= v_rhs) ? "OK" : "KO") << std::endl;
+
+#if __cplusplus >= 201103L
+	std::cout << "\n################################################" << std::endl;
+	std::cout << "===== move | emplace (c++11) =====" << std::endl;
+	TESTED_NAMESPACE::vector<MoveOnly> v_move;
+	std::cout << "emplace_back: " << v_move.emplace_back(1).value << std::endl;
+	MoveOnly mo_push(2);
+	v_move.push_back(std::move(mo_push));
+	std::cout << "moved-from after push_back: " << mo_push.value << std::endl;
+	v_move.emplace(v_move.begin(), 0);
+	MoveOnly mo_insert(5);
+	TESTED_NAMESPACE::vector<MoveOnly>::iterator mo_it = v_move.insert(v_move.begin() + 1, std::move(mo_insert));
+	std::cout << "moved-from after insert: " << mo_insert.value << "\tinserted: " << mo_it->value << std::endl;
+	for (int i = 3; i < 9; ++i)
+		v_move.emplace_back(i);
+	std::cout << "size: " << v_move.size() << std::endl;
+	for (unsigned int i = 0; i < v_move.size(); ++i)
+		std::cout << "- " << v_move[i].value << std::endl;
+
+	TESTED_NAMESPACE::vector<MoveOnly> v_moved(std::move(v_move));
+	std::cout << "move constructor: " << v_moved.size() << "\tmoved-from size: " << v_move.size() << std::endl;
+	TESTED_NAMESPACE::vector<MoveOnly> v_move_assign;
+	v_move_assign.emplace_back(42);
+	v_move_assign = std::move(v_moved);
+	std::cout << "move assignment: " << v_move_assign.size() << "\tmoved-from size: " << v_moved.size() << std::endl;
+	std::cout << "front: " << v_move_assign.front().value << "\tback: " << v_move_assign.back().value << std::endl;
+	v_moved.emplace_back(7);
+	std::cout << "reuse moved-from: " << v_moved.size() << " " << v_moved[0].value << std::endl;
+#endif
 }